@@ -0,0 +1,459 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/BlockCompressor.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+const size_t BlockCompressor::FRAME_HEADER_SIZE = 12;
+
+const size_t BlockCompressor::MIN_COMPRESSIBLE_LENGTH = 64;
+
+namespace
+{
+    const uint8_t FRAME_MAGIC[3] = {'F', 'C', 'Z'};
+
+    const uint8_t METHOD_STORED = 0;
+    const uint8_t METHOD_LZ = 1;
+
+    const char* const MALFORMED_FRAME_MESSAGE = "Malformed compressed frame";
+
+    /*
+     * The compressed data is a sequence of blocks: a token with the number of literals in its high nibble and the length
+     * of the match minus 4 in its low nibble, extra bytes of the number of literals when the nibble is 15, the literals,
+     * the offset of the match in 2 bytes little endian and extra bytes of the length of the match when the nibble is 15.
+     * The last block only has literals.
+     */
+    const size_t MIN_MATCH = 4;
+
+    // The last literals are never part of a match and the last match starts before this many bytes from the end,
+    // so the decoder can copy by words.
+    const size_t LAST_LITERALS = 5;
+    const size_t MATCH_FIND_LIMIT = 12;
+
+    const size_t MAX_OFFSET = 65535;
+
+    // Each extra byte of a length adds at most 255 bytes to the payload, and no other byte of the compressed data adds more.
+    const size_t MAX_EXPANSION = 255;
+
+    const unsigned HASH_LOG = 12;
+
+    // After 2^SKIP_TRIGGER positions without a match the search steps grow, so incompressible data is crossed quickly.
+    const unsigned SKIP_TRIGGER = 6;
+
+    inline uint32_t read32(const uint8_t *source)
+    {
+        uint32_t value;
+        memcpy(&value, source, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t read64(const uint8_t *source)
+    {
+        uint64_t value;
+        memcpy(&value, source, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t hashPosition(uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - HASH_LOG);
+    }
+
+    // Number of equal bytes at the beginning of two words given their XOR.
+    inline size_t commonBytes(uint64_t difference)
+    {
+#if __BIG_ENDIAN__
+#if defined(__GNUC__)
+        return (size_t)__builtin_clzll(difference) >> 3;
+#else
+        size_t count = 0;
+
+        for(; (difference & 0xff00000000000000ull) == 0; difference <<= 8)
+            ++count;
+
+        return count;
+#endif
+#else
+#if defined(__GNUC__)
+        return (size_t)__builtin_ctzll(difference) >> 3;
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, difference);
+        return (size_t)index >> 3;
+#else
+        size_t count = 0;
+
+        for(; (difference & 0xff) == 0; difference >>= 8)
+            ++count;
+
+        return count;
+#endif
+#endif
+    }
+
+    inline uint8_t* writeLength(uint8_t *output, size_t length)
+    {
+        for(; length >= 255; length -= 255)
+            *output++ = 255;
+
+        *output++ = (uint8_t)length;
+        return output;
+    }
+
+    // Length of the common prefix of two sequences, compared a word at a time.
+    inline size_t countMatch(const uint8_t *input, const uint8_t *match, const uint8_t *limit)
+    {
+        const uint8_t *start = input;
+
+        while(input + sizeof(uint64_t) <= limit)
+        {
+            uint64_t difference = read64(input) ^ read64(match);
+
+            if(difference != 0)
+                return (size_t)(input - start) + commonBytes(difference);
+
+            input += sizeof(uint64_t);
+            match += sizeof(uint64_t);
+        }
+
+        while(input < limit && *input == *match)
+        {
+            ++input;
+            ++match;
+        }
+
+        return (size_t)(input - start);
+    }
+
+    inline size_t writeLastLiterals(const uint8_t *anchor, const uint8_t *end, uint8_t *output, uint8_t *outputLimit,
+            uint8_t *destination)
+    {
+        size_t literals = (size_t)(end - anchor);
+
+        if((size_t)(outputLimit - output) < 1 + literals + literals / 255 + 1)
+            return 0;
+
+        if(literals >= 15)
+        {
+            *output++ = 15 << 4;
+            output = writeLength(output, literals - 15);
+        }
+        else
+            *output++ = (uint8_t)(literals << 4);
+
+        memcpy(output, anchor, literals);
+        output += literals;
+
+        return (size_t)(output - destination);
+    }
+
+    // Returns the size of the compressed data, or 0 if it would be longer than the limit.
+    size_t compressBlock(const uint8_t *source, size_t length, uint8_t *destination, size_t limit)
+    {
+        uint32_t table[1 << HASH_LOG];
+        const uint8_t *input = source;
+        const uint8_t *anchor = source;
+        const uint8_t *const end = source + length;
+        uint8_t *output = destination;
+        uint8_t *const outputLimit = destination + limit;
+
+        memset(table, 0, sizeof(table));
+
+        if(length > MATCH_FIND_LIMIT)
+        {
+            const uint8_t *const matchLimit = end - LAST_LITERALS;
+            const uint8_t *const findLimit = end - MATCH_FIND_LIMIT;
+
+            ++input;
+
+            while(true)
+            {
+                const uint8_t *match = NULL;
+                const uint8_t *forward = input;
+                unsigned searchCount = 1 << SKIP_TRIGGER;
+
+                // Finds a match.
+                do
+                {
+                    input = forward;
+                    forward += searchCount++ >> SKIP_TRIGGER;
+
+                    if(input > findLimit)
+                        goto lastLiterals;
+
+                    uint32_t hash = hashPosition(read32(input));
+                    match = source + table[hash];
+                    table[hash] = (uint32_t)(input - source);
+                }
+                while((size_t)(input - match) > MAX_OFFSET || match == input || read32(match) != read32(input));
+
+                // Extends the match backwards.
+                while(input > anchor && match > source && input[-1] == match[-1])
+                {
+                    --input;
+                    --match;
+                }
+
+                size_t literals = (size_t)(input - anchor);
+
+                // Token, literals with their length, offset and the first byte of the match length.
+                if((size_t)(outputLimit - output) < 1 + literals + literals / 255 + 1 + 2 + 1)
+                    return 0;
+
+                uint8_t *token = output++;
+
+                if(literals >= 15)
+                {
+                    *token = 15 << 4;
+                    output = writeLength(output, literals - 15);
+                }
+                else
+                    *token = (uint8_t)(literals << 4);
+
+                memcpy(output, anchor, literals);
+                output += literals;
+
+                size_t offset = (size_t)(input - match);
+                *output++ = (uint8_t)offset;
+                *output++ = (uint8_t)(offset >> 8);
+
+                input += MIN_MATCH + countMatch(input + MIN_MATCH, match + MIN_MATCH, matchLimit);
+                size_t matchLength = (size_t)(input - anchor) - literals - MIN_MATCH;
+
+                if((size_t)(outputLimit - output) < matchLength / 255 + 1)
+                    return 0;
+
+                if(matchLength >= 15)
+                {
+                    *token |= 15;
+                    output = writeLength(output, matchLength - 15);
+                }
+                else
+                    *token |= (uint8_t)matchLength;
+
+                anchor = input;
+
+                if(input > findLimit)
+                    break;
+
+                table[hashPosition(read32(input - 2))] = (uint32_t)(input - 2 - source);
+            }
+        }
+
+lastLiterals:
+        return writeLastLiterals(anchor, end, output, outputLimit, destination);
+    }
+
+    inline bool readLength(const uint8_t *&input, const uint8_t *end, size_t &length)
+    {
+        uint8_t byte;
+
+        do
+        {
+            if(input >= end)
+                return false;
+
+            byte = *input++;
+            length += byte;
+        }
+        while(byte == 255);
+
+        return true;
+    }
+
+    bool decompressBlock(const uint8_t *source, size_t size, uint8_t *destination, size_t length)
+    {
+        const uint8_t *input = source;
+        const uint8_t *const inputEnd = source + size;
+        uint8_t *output = destination;
+        uint8_t *const outputEnd = destination + length;
+
+        while(input < inputEnd)
+        {
+            unsigned token = *input++;
+            size_t literals = token >> 4;
+
+            if(literals == 15 && !readLength(input, inputEnd, literals))
+                return false;
+
+            if(literals > (size_t)(inputEnd - input) || literals > (size_t)(outputEnd - output))
+                return false;
+
+            memcpy(output, input, literals);
+            output += literals;
+            input += literals;
+
+            if(input == inputEnd)
+                break;
+
+            if(inputEnd - input < 2)
+                return false;
+
+            size_t offset = (size_t)input[0] | ((size_t)input[1] << 8);
+            input += 2;
+
+            if(offset == 0 || offset > (size_t)(output - destination))
+                return false;
+
+            size_t matchLength = token & 15;
+
+            if(matchLength == 15 && !readLength(input, inputEnd, matchLength))
+                return false;
+
+            matchLength += MIN_MATCH;
+
+            if(matchLength > (size_t)(outputEnd - output))
+                return false;
+
+            const uint8_t *match = output - offset;
+
+            if(offset >= sizeof(uint64_t) && (size_t)(outputEnd - output) >= matchLength + sizeof(uint64_t))
+            {
+                // Copies by words, possibly beyond the match: the next blocks overwrite it.
+                uint8_t *copyEnd = output + matchLength;
+
+                for(; output < copyEnd; output += sizeof(uint64_t), match += sizeof(uint64_t))
+                    memcpy(output, match, sizeof(uint64_t));
+
+                output = copyEnd;
+            }
+            else
+            {
+                for(size_t count = 0; count < matchLength; ++count)
+                    output[count] = match[count];
+
+                output += matchLength;
+            }
+        }
+
+        return output == outputEnd;
+    }
+
+    inline void writeUInt32(uint8_t *destination, uint32_t value)
+    {
+        destination[0] = (uint8_t)value;
+        destination[1] = (uint8_t)(value >> 8);
+        destination[2] = (uint8_t)(value >> 16);
+        destination[3] = (uint8_t)(value >> 24);
+    }
+
+    inline uint32_t readUInt32(const uint8_t *source)
+    {
+        return (uint32_t)source[0] | ((uint32_t)source[1] << 8) | ((uint32_t)source[2] << 16) | ((uint32_t)source[3] << 24);
+    }
+}
+
+size_t BlockCompressor::getMaxFrameSize(size_t length)
+{
+    return FRAME_HEADER_SIZE + length;
+}
+
+size_t BlockCompressor::compress(const char *source, size_t length, char *destination)
+{
+    if(length > 0xffffffffu)
+        throw BadParamException("Payload too long for a compressed frame");
+
+    uint8_t *header = (uint8_t*)destination;
+    uint8_t *data = header + FRAME_HEADER_SIZE;
+    size_t size = 0;
+
+    // Compressing has to save at least 1/16 of the payload.
+    if(length >= MIN_COMPRESSIBLE_LENGTH)
+        size = compressBlock((const uint8_t*)source, length, data, length - length / 16);
+
+    memcpy(header, FRAME_MAGIC, sizeof(FRAME_MAGIC));
+
+    if(size != 0)
+        header[3] = METHOD_LZ;
+    else
+    {
+        header[3] = METHOD_STORED;
+
+        if(length > 0)
+            memcpy(data, source, length);
+
+        size = length;
+    }
+
+    writeUInt32(header + 4, (uint32_t)length);
+    writeUInt32(header + 8, (uint32_t)size);
+
+    return FRAME_HEADER_SIZE + size;
+}
+
+size_t BlockCompressor::compress(const FastBuffer &source, size_t length, FastBuffer &destination)
+{
+    if(!destination.reserve(getMaxFrameSize(length)))
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    return compress(source.getBuffer(), length, destination.getBuffer());
+}
+
+size_t BlockCompressor::getPayloadLength(const char *frame, size_t size)
+{
+    const uint8_t *header = (const uint8_t*)frame;
+
+    if(size < FRAME_HEADER_SIZE || memcmp(header, FRAME_MAGIC, sizeof(FRAME_MAGIC)) != 0 ||
+            (header[3] != METHOD_STORED && header[3] != METHOD_LZ))
+        throw BadParamException(MALFORMED_FRAME_MESSAGE);
+
+    size_t length = readUInt32(header + 4);
+    size_t dataSize = readUInt32(header + 8);
+
+    // The length is checked against the compressed data, so no memory is reserved for a payload the frame cannot produce.
+    if(dataSize > size - FRAME_HEADER_SIZE || (header[3] == METHOD_STORED && length != dataSize) ||
+            (header[3] == METHOD_LZ && (uint64_t)dataSize * MAX_EXPANSION < length))
+        throw BadParamException(MALFORMED_FRAME_MESSAGE);
+
+    return length;
+}
+
+size_t BlockCompressor::decompress(const char *frame, size_t size, char *destination, size_t destinationSize)
+{
+    size_t length = getPayloadLength(frame, size);
+    const uint8_t *header = (const uint8_t*)frame;
+    size_t dataSize = readUInt32(header + 8);
+
+    if(length > destinationSize)
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    if(header[3] == METHOD_STORED)
+    {
+        if(length > 0)
+            memcpy(destination, header + FRAME_HEADER_SIZE, length);
+    }
+    else if(!decompressBlock(header + FRAME_HEADER_SIZE, dataSize, (uint8_t*)destination, length))
+        throw BadParamException(MALFORMED_FRAME_MESSAGE);
+
+    return length;
+}
+
+size_t BlockCompressor::decompress(const FastBuffer &source, size_t size, FastBuffer &destination)
+{
+    size_t length = getPayloadLength(source.getBuffer(), size);
+
+    if(!destination.reserve(length))
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    return decompress(source.getBuffer(), size, destination.getBuffer(), destination.getBufferSize());
+}
@@ -0,0 +1,280 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/BoolPacking.h>
+
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FASTCDR_BOOLPACKING_SSE2
+#endif
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    // The word kernels read and write booleans as bytes.
+    const bool BOOL_IS_BYTE = sizeof(bool) == 1;
+
+    const uint64_t LOW_BITS = 0x0101010101010101ull;
+
+    inline uint64_t loadLittleEndian(const void *source)
+    {
+        uint64_t word;
+        memcpy(&word, source, sizeof(word));
+#if __BIG_ENDIAN__
+        word = ((word & 0x00000000ffffffffull) << 32) | ((word & 0xffffffff00000000ull) >> 32);
+        word = ((word & 0x0000ffff0000ffffull) << 16) | ((word & 0xffff0000ffff0000ull) >> 16);
+        word = ((word & 0x00ff00ff00ff00ffull) << 8) | ((word & 0xff00ff00ff00ff00ull) >> 8);
+#endif
+        return word;
+    }
+
+    inline void storeLittleEndian(void *destination, uint64_t word)
+    {
+#if __BIG_ENDIAN__
+        word = ((word & 0x00000000ffffffffull) << 32) | ((word & 0xffffffff00000000ull) >> 32);
+        word = ((word & 0x0000ffff0000ffffull) << 16) | ((word & 0xffff0000ffff0000ull) >> 16);
+        word = ((word & 0x00ff00ff00ff00ffull) << 8) | ((word & 0xff00ff00ff00ff00ull) >> 8);
+#endif
+        memcpy(destination, &word, sizeof(word));
+    }
+
+    // Gathers the lowest bit of each byte of a word of zeros and ones: byte i goes to bit i.
+    inline uint8_t compressBits(uint64_t word)
+    {
+        return (uint8_t)((word * 0x0102040810204080ull) >> 56);
+    }
+
+    // Spreads bit i of a byte to the byte i of a word, as a zero or a one.
+    inline uint64_t expandBits(uint8_t bits)
+    {
+        uint64_t word = ((uint64_t)bits * LOW_BITS) & 0x8040201008040201ull;
+        return ((word + 0x7f7f7f7f7f7f7f7full) >> 7) & LOW_BITS;
+    }
+
+    // Checks that the bits after the last boolean, in the last byte, are zero.
+    inline bool unusedBitsAreZero(const char *source, size_t numElements)
+    {
+        return numElements % 8 == 0 || ((uint8_t)source[numElements / 8] >> (numElements % 8)) == 0;
+    }
+}
+
+void BoolPacking::pack(const bool *bool_t, size_t numElements, char *destination)
+{
+    size_t count = 0;
+
+    if(BOOL_IS_BYTE)
+    {
+#ifdef FASTCDR_BOOLPACKING_SSE2
+        for(; count + 16 <= numElements; count += 16)
+        {
+            // Moves the boolean bit of each byte to its sign bit.
+            __m128i bytes = _mm_slli_epi16(_mm_loadu_si128((const __m128i*)(bool_t + count)), 7);
+            int mask = _mm_movemask_epi8(bytes);
+            destination[count / 8] = (char)mask;
+            destination[count / 8 + 1] = (char)(mask >> 8);
+        }
+#endif
+        for(; count + 8 <= numElements; count += 8)
+            destination[count / 8] = (char)compressBits(loadLittleEndian(bool_t + count));
+    }
+
+    for(; count < numElements; count += 8)
+    {
+        size_t bitsInByte = numElements - count < 8 ? numElements - count : 8;
+        uint8_t bits = 0;
+
+        for(size_t bit = 0; bit < bitsInByte; ++bit)
+        {
+            if(bool_t[count + bit])
+                bits |= (uint8_t)(1 << bit);
+        }
+
+        destination[count / 8] = (char)bits;
+    }
+}
+
+bool BoolPacking::unpack(const char *source, size_t numElements, bool *bool_t)
+{
+    size_t count = 0;
+
+    if(!unusedBitsAreZero(source, numElements))
+        return false;
+
+    if(BOOL_IS_BYTE)
+    {
+        for(; count + 8 <= numElements; count += 8)
+            storeLittleEndian(bool_t + count, expandBits((uint8_t)source[count / 8]));
+    }
+
+    for(; count < numElements; ++count)
+        bool_t[count] = ((uint8_t)source[count / 8] >> (count % 8)) & 1;
+
+    return true;
+}
+
+void BoolPacking::pack(const std::vector<bool> &vector_t, char *destination)
+{
+    std::vector<bool>::const_iterator it = vector_t.begin();
+    size_t numElements = vector_t.size();
+
+    for(size_t count = 0; count < numElements; count += 8)
+    {
+        size_t bitsInByte = numElements - count < 8 ? numElements - count : 8;
+        uint8_t bits = 0;
+
+        for(size_t bit = 0; bit < bitsInByte; ++bit, ++it)
+        {
+            if(*it)
+                bits |= (uint8_t)(1 << bit);
+        }
+
+        destination[count / 8] = (char)bits;
+    }
+}
+
+bool BoolPacking::unpack(const char *source, std::vector<bool> &vector_t)
+{
+    std::vector<bool>::iterator it = vector_t.begin();
+    size_t numElements = vector_t.size();
+
+    if(!unusedBitsAreZero(source, numElements))
+        return false;
+
+    for(size_t count = 0; count < numElements; count += 8)
+    {
+        size_t bitsInByte = numElements - count < 8 ? numElements - count : 8;
+        uint8_t bits = (uint8_t)source[count / 8];
+
+        for(size_t bit = 0; bit < bitsInByte; ++bit, ++it)
+            *it = (bits >> bit) & 1;
+    }
+
+    return true;
+}
+
+void BoolPacking::toBytes(const bool *bool_t, size_t numElements, char *destination)
+{
+    // A bool object only holds false or true, stored as 0 or 1.
+    if(BOOL_IS_BYTE)
+    {
+        memcpy(destination, bool_t, numElements);
+        return;
+    }
+
+    for(size_t count = 0; count < numElements; ++count)
+        destination[count] = bool_t[count] ? 1 : 0;
+}
+
+bool BoolPacking::fromBytes(const char *source, size_t numElements, bool *bool_t)
+{
+    size_t count = 0;
+
+    if(BOOL_IS_BYTE)
+    {
+        // Each block is checked before it is stored, so no invalid bool object is created.
+#ifdef FASTCDR_BOOLPACKING_SSE2
+        const __m128i ones = _mm_set1_epi8(1);
+        const __m128i zeros = _mm_setzero_si128();
+
+        for(; count + 16 <= numElements; count += 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)(source + count));
+
+            if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(bytes, ones), zeros)) != 0xffff)
+                return false;
+
+            _mm_storeu_si128((__m128i*)(bool_t + count), bytes);
+        }
+#endif
+        for(; count + 8 <= numElements; count += 8)
+        {
+            uint64_t word;
+            memcpy(&word, source + count, sizeof(word));
+
+            if((word & ~LOW_BITS) != 0)
+                return false;
+
+            memcpy(bool_t + count, &word, sizeof(word));
+        }
+    }
+
+    for(; count < numElements; ++count)
+    {
+        uint8_t value = (uint8_t)source[count];
+
+        if(value > 1)
+            return false;
+
+        bool_t[count] = value == 1;
+    }
+
+    return true;
+}
+
+void BoolPacking::toBytes(const std::vector<bool> &vector_t, char *destination)
+{
+    std::vector<bool>::const_iterator it = vector_t.begin();
+    size_t numElements = vector_t.size();
+    size_t count = 0;
+
+    for(; count + 8 <= numElements; count += 8)
+    {
+        uint8_t bits = 0;
+
+        for(size_t bit = 0; bit < 8; ++bit, ++it)
+        {
+            if(*it)
+                bits |= (uint8_t)(1 << bit);
+        }
+
+        storeLittleEndian(destination + count, expandBits(bits));
+    }
+
+    for(; count < numElements; ++count, ++it)
+        destination[count] = *it ? 1 : 0;
+}
+
+bool BoolPacking::fromBytes(const char *source, std::vector<bool> &vector_t)
+{
+    std::vector<bool>::iterator it = vector_t.begin();
+    size_t numElements = vector_t.size();
+    size_t count = 0;
+
+    for(; count + 8 <= numElements; count += 8)
+    {
+        uint64_t word = loadLittleEndian(source + count);
+
+        if((word & ~LOW_BITS) != 0)
+            return false;
+
+        uint8_t bits = compressBits(word);
+
+        for(size_t bit = 0; bit < 8; ++bit, ++it)
+            *it = (bits >> bit) & 1;
+    }
+
+    for(; count < numElements; ++count, ++it)
+    {
+        uint8_t value = (uint8_t)source[count];
+
+        if(value > 1)
+            return false;
+
+        *it = value == 1;
+    }
+
+    return true;
+}
@@ -0,0 +1,160 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/BufferTrimmer.h>
+
+#include <vector>
+#include <algorithm>
+
+using namespace eprosima::fastcdr;
+
+BufferTrimmer::BufferTrimmer(uint32_t idleThresholdMs, size_t memoryBudget) : m_idleThreshold(idleThresholdMs),
+    m_memoryBudget(memoryBudget), m_running(false)
+{
+}
+
+BufferTrimmer::~BufferTrimmer()
+{
+    stop();
+}
+
+void BufferTrimmer::add(FastBuffer &buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Usage &usage = m_buffers[&buffer];
+    usage.busy = false;
+    usage.lastUse = std::chrono::steady_clock::now();
+}
+
+void BufferTrimmer::remove(FastBuffer &buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.erase(&buffer);
+}
+
+void BufferTrimmer::acquire(FastBuffer &buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<FastBuffer*, Usage>::iterator it = m_buffers.find(&buffer);
+
+    if(it != m_buffers.end())
+        it->second.busy = true;
+}
+
+void BufferTrimmer::release(FastBuffer &buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<FastBuffer*, Usage>::iterator it = m_buffers.find(&buffer);
+
+    if(it != m_buffers.end())
+    {
+        it->second.busy = false;
+        it->second.lastUse = std::chrono::steady_clock::now();
+    }
+}
+
+size_t BufferTrimmer::trim()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::vector<std::pair<std::chrono::steady_clock::time_point, FastBuffer*>> idle;
+    size_t totalSize = 0;
+    size_t trimmed = 0;
+
+    for(std::map<FastBuffer*, Usage>::iterator it = m_buffers.begin(); it != m_buffers.end(); ++it)
+    {
+        FastBuffer &buffer = *it->first;
+
+        if(!it->second.busy && m_idleThreshold.count() > 0 && now - it->second.lastUse >= m_idleThreshold)
+        {
+            trimmed += trimBuffer(buffer);
+            continue;
+        }
+
+        totalSize += buffer.isInternalBuffer() ? buffer.getPacketLength(buffer.getBufferSize()) : 0;
+
+        if(!it->second.busy)
+            idle.push_back(std::make_pair(it->second.lastUse, &buffer));
+    }
+
+    if(m_memoryBudget > 0 && totalSize > m_memoryBudget)
+    {
+        // Least recently used first.
+        std::sort(idle.begin(), idle.end());
+
+        for(size_t index = 0; index < idle.size() && totalSize > m_memoryBudget; ++index)
+        {
+            size_t size = trimBuffer(*idle[index].second);
+            totalSize -= size;
+            trimmed += size;
+        }
+    }
+
+    return trimmed;
+}
+
+size_t BufferTrimmer::getTotalSize()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t totalSize = 0;
+
+    for(std::map<FastBuffer*, Usage>::iterator it = m_buffers.begin(); it != m_buffers.end(); ++it)
+    {
+        if(it->first->isInternalBuffer())
+            totalSize += it->first->getPacketLength(it->first->getBufferSize());
+    }
+
+    return totalSize;
+}
+
+void BufferTrimmer::start(uint32_t periodMs)
+{
+    stop();
+
+    m_running = true;
+    m_thread = std::thread([this, periodMs]()
+            {
+                std::unique_lock<std::mutex> lock(m_threadMutex);
+
+                while(!m_threadCondition.wait_for(lock, std::chrono::milliseconds(periodMs), [this]{ return !m_running; }))
+                {
+                    lock.unlock();
+                    trim();
+                    lock.lock();
+                }
+            });
+}
+
+void BufferTrimmer::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        m_running = false;
+    }
+
+    m_threadCondition.notify_all();
+
+    if(m_thread.joinable())
+        m_thread.join();
+}
+
+size_t BufferTrimmer::trimBuffer(FastBuffer &buffer)
+{
+    if(!buffer.isInternalBuffer() || buffer.getPacket() == NULL)
+        return 0;
+
+    size_t size = buffer.getPacketLength(buffer.getBufferSize());
+    buffer.shrink(0);
+    return size;
+}
@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include <fastcdr/Cdr.h>
+#include <fastcdr/BoolPacking.h>
+#include <fastcdr/ColumnTransposer.h>
+#include <fastcdr/ThreadPool.h>
+#include <fastcdr/TimeSeriesCodec.h>
 #include <fastcdr/exceptions/BadParamException.h>
 
 using namespace eprosima::fastcdr;
@@ -26,6 +30,42 @@ const Cdr::Endianness Cdr::DEFAULT_ENDIAN = LITTLE_ENDIANNESS;
 
 CONSTEXPR size_t ALIGNMENT_LONG_DOUBLE = 8;
 
+// Maximum alignment of the primitive types in XCDR1 and XCDR2.
+CONSTEXPR size_t XCDR1_MAX_ALIGNMENT = 8;
+CONSTEXPR size_t XCDR2_MAX_ALIGNMENT = 4;
+
+// Fields of an XCDR2 member header (EMHEADER).
+CONSTEXPR uint32_t EMHEADER_MUST_UNDERSTAND = 0x80000000;
+CONSTEXPR uint32_t EMHEADER_MEMBER_ID_MASK = 0x0FFFFFFF;
+CONSTEXPR uint32_t EMHEADER_LC_SHIFT = 28;
+
+// Size of the chunks of an array copied by each task of a parallel copy.
+CONSTEXPR size_t PARALLEL_COPY_CHUNK = 256 * 1024;
+
+// Number of elements converted at once by the lossy codecs.
+CONSTEXPR size_t CODEC_BLOCK = 256;
+
+const size_t Cdr::DEFAULT_PARALLEL_THRESHOLD = 4 * 1024 * 1024;
+
+const uint16_t Cdr::PID_SENTINEL = 0x3f02;
+const uint16_t Cdr::PID_EXTENDED = 0x3f01;
+
+// Bits of a parameter identifier that are the identifier itself, without the flags.
+CONSTEXPR uint32_t PID_MASK = 0x3fff;
+
+namespace
+{
+    template<size_t _Size>
+        void swapCopy(char *dst, const char *src, size_t totalSize)
+        {
+            for(const char *end = src + totalSize; src < end; src += _Size, dst += _Size)
+            {
+                for(size_t count = 0; count < _Size; ++count)
+                    dst[count] = src[_Size - 1 - count];
+            }
+        }
+}
+
 Cdr::state::state(const Cdr &cdr) : m_currentPosition(cdr.m_currentPosition), m_alignPosition(cdr.m_alignPosition),
     m_swapBytes(cdr.m_swapBytes), m_lastDataSize(cdr.m_lastDataSize) {}
 
@@ -35,7 +75,8 @@ Cdr::state::state(const Cdr &cdr) : m_currentPosition(cdr.m_currentPosition), m_
 Cdr::Cdr(FastBuffer &cdrBuffer, const Endianness endianness, const CdrType cdrType) : m_cdrBuffer(cdrBuffer),
     m_cdrType(cdrType), m_plFlag(DDS_CDR_WITHOUT_PL), m_options(0), m_endianness((uint8_t)endianness),
     m_swapBytes(endianness == DEFAULT_ENDIAN ? false : true), m_lastDataSize(0), m_currentPosition(cdrBuffer.begin()),
-    m_alignPosition(cdrBuffer.begin()), m_lastPosition(cdrBuffer.end())
+    m_alignPosition(cdrBuffer.begin()), m_lastPosition(cdrBuffer.end()), m_threadPool(NULL),
+    m_parallelThreshold(DEFAULT_PARALLEL_THRESHOLD), m_encoding(PLAIN_CDR), m_maxAlignment(XCDR1_MAX_ALIGNMENT)
 {
 }
 
@@ -69,18 +110,37 @@ Cdr& Cdr::read_encapsulation()
         ex.raise();
     }
 
+    uint8_t encoding = encapsulationKind & (uint8_t)~0x1;
+
+    // XCDR2 encapsulations.
+    if(encoding == PLAIN_CDR2 || encoding == DELIMIT_CDR2 || encoding == PL_CDR2)
+    {
+        if(m_cdrType != DDS_CDR)
+            throw BadParamException("Unexpected CDR type received in Cdr::read_encapsulation");
+
+        m_plFlag = DDS_CDR_WITHOUT_PL;
+        m_encoding = (EncodingAlgorithmFlag)encoding;
+        m_maxAlignment = XCDR2_MAX_ALIGNMENT;
+    }
     // If it is DDS_CDR type, view if contains a parameter list.
-    if(encapsulationKind & DDS_CDR_WITH_PL)
+    else if(encapsulationKind & DDS_CDR_WITH_PL)
     {
         if(m_cdrType == DDS_CDR)
         {
             m_plFlag = DDS_CDR_WITH_PL;
+            m_encoding = PL_CDR;
+            m_maxAlignment = XCDR1_MAX_ALIGNMENT;
         }
         else
         {
             throw BadParamException("Unexpected CDR type received in Cdr::read_encapsulation");
         }
     }
+    else
+    {
+        m_encoding = PLAIN_CDR;
+        m_maxAlignment = XCDR1_MAX_ALIGNMENT;
+    }
 
     try
     {
@@ -111,7 +171,10 @@ Cdr& Cdr::serialize_encapsulation()
         }
 
         // Construct encapsulation byte.
-        encapsulationKind = ((uint8_t)m_plFlag | m_endianness);
+        if(m_maxAlignment == XCDR2_MAX_ALIGNMENT)
+            encapsulationKind = ((uint8_t)m_encoding | m_endianness);
+        else
+            encapsulationKind = ((uint8_t)m_plFlag | m_endianness);
 
         // Serialize the encapsulation byte.
         (*this) << encapsulationKind;
@@ -206,6 +269,7 @@ void Cdr::reset()
 {
     m_currentPosition = m_cdrBuffer.begin();
     m_alignPosition = m_cdrBuffer.begin();
+    m_lastPosition = m_cdrBuffer.end();
     m_swapBytes = m_endianness == DEFAULT_ENDIAN ? false : true;
     m_lastDataSize = 0;
 }
@@ -223,6 +287,338 @@ bool Cdr::moveAlignmentForward(size_t numBytes)
     return returnedValue;
 }
 
+void Cdr::setParallelCopy(ThreadPool *pool, size_t threshold)
+{
+    m_threadPool = pool;
+    m_parallelThreshold = threshold;
+}
+
+size_t Cdr::getNumThreads(const ThreadPool &pool)
+{
+    return pool.getNumThreads();
+}
+
+void Cdr::runParallel(ThreadPool &pool, size_t numTasks, void (*task)(void*, size_t), void *context)
+{
+    pool.parallelFor(numTasks, [=](size_t index)
+    {
+        task(context, index);
+    });
+}
+
+Cdr::EncodingAlgorithmFlag Cdr::getEncodingAlgorithm() const
+{
+    return m_encoding;
+}
+
+void Cdr::setEncodingAlgorithm(EncodingAlgorithmFlag encoding)
+{
+    m_encoding = encoding;
+
+    if(encoding == PLAIN_CDR || encoding == PL_CDR)
+    {
+        m_plFlag = encoding == PL_CDR ? DDS_CDR_WITH_PL : DDS_CDR_WITHOUT_PL;
+        m_maxAlignment = XCDR1_MAX_ALIGNMENT;
+    }
+    else
+    {
+        m_maxAlignment = XCDR2_MAX_ALIGNMENT;
+    }
+}
+
+size_t Cdr::beginSerializeDHeader()
+{
+    // The length is filled later, so the position is taken after the alignment.
+    serialize((uint32_t)0);
+    return (m_currentPosition - m_cdrBuffer.begin()) - sizeof(uint32_t);
+}
+
+Cdr& Cdr::endSerializeDHeader(size_t position)
+{
+    patchLength(position, (uint32_t)((m_currentPosition - m_cdrBuffer.begin()) - position - sizeof(uint32_t)));
+    return *this;
+}
+
+uint32_t Cdr::deserializeDHeader()
+{
+    uint32_t length = 0;
+    deserialize(length);
+    return length;
+}
+
+Cdr& Cdr::skipDelimited()
+{
+    state state(*this);
+    uint32_t length = deserializeDHeader();
+
+    try
+    {
+        skipMember(length);
+    }
+    catch(Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+Cdr& Cdr::serializeEMHeader(uint32_t memberId, bool mustUnderstand, EMHeaderLengthCode lengthCode, uint32_t nextInt)
+{
+    state state(*this);
+    uint32_t header = (mustUnderstand ? EMHEADER_MUST_UNDERSTAND : 0) | ((uint32_t)lengthCode << EMHEADER_LC_SHIFT) |
+        (memberId & EMHEADER_MEMBER_ID_MASK);
+
+    try
+    {
+        serialize(header);
+
+        if(lengthCode == EMHEADER_LC_NEXTINT)
+            serialize(nextInt);
+    }
+    catch(Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+size_t Cdr::beginSerializeEMHeader(uint32_t memberId, bool mustUnderstand)
+{
+    serializeEMHeader(memberId, mustUnderstand, EMHEADER_LC_NEXTINT, 0);
+    return (m_currentPosition - m_cdrBuffer.begin()) - sizeof(uint32_t);
+}
+
+Cdr& Cdr::deserializeEMHeader(uint32_t &memberId, bool &mustUnderstand, size_t &memberSize)
+{
+    state state(*this);
+    uint32_t header = 0, nextInt = 0;
+
+    try
+    {
+        deserialize(header);
+        EMHeaderLengthCode lengthCode = (EMHeaderLengthCode)((header >> EMHEADER_LC_SHIFT) & 0x7);
+
+        if(lengthCode <= EMHEADER_LC_8)
+        {
+            memberSize = (size_t)1 << lengthCode;
+        }
+        else if(lengthCode == EMHEADER_LC_NEXTINT)
+        {
+            deserialize(nextInt);
+            memberSize = nextInt;
+        }
+        else
+        {
+            // The NEXTINT belongs to the member, so it is read without consuming it.
+            Cdr::state member(*this);
+            deserialize(nextInt);
+            memberSize = sizeof(uint32_t) + (lengthCode == EMHEADER_LC_DHEADER ? (size_t)nextInt :
+                    (lengthCode == EMHEADER_LC_4_ELEMENTS ? 4 : 8) * (size_t)nextInt);
+            setState(member);
+        }
+    }
+    catch(Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    memberId = header & EMHEADER_MEMBER_ID_MASK;
+    mustUnderstand = (header & EMHEADER_MUST_UNDERSTAND) != 0;
+    return *this;
+}
+
+Cdr& Cdr::skipMember(size_t memberSize)
+{
+    if((m_lastPosition - m_currentPosition) < memberSize)
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    m_currentPosition += memberSize;
+
+    // The skipped bytes are not known to keep any alignment.
+    m_lastDataSize = 0;
+    return *this;
+}
+
+size_t Cdr::beginSerializeParameter(uint32_t pid)
+{
+    state state(*this);
+    size_t position = 0;
+
+    try
+    {
+        // The header is aligned to 4 bytes, so its position is taken after serializing its first field.
+        if(pid <= 0xffff && (pid & PID_MASK) != (PID_EXTENDED & PID_MASK))
+        {
+            serialize((uint16_t)pid);
+            position = (m_currentPosition - m_cdrBuffer.begin()) - sizeof(uint16_t);
+            serialize((uint16_t)0);
+        }
+        else
+        {
+            serialize(PID_EXTENDED);
+            position = (m_currentPosition - m_cdrBuffer.begin()) - sizeof(uint16_t);
+            serialize((uint16_t)8);
+            serialize(pid);
+            serialize((uint32_t)0);
+        }
+    }
+    catch(Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    resetAlignment();
+    return position;
+}
+
+Cdr& Cdr::endSerializeParameter(size_t position)
+{
+    uint16_t pid = 0;
+    memcpy(&pid, m_cdrBuffer.getBuffer() + position, sizeof(pid));
+
+    if(m_swapBytes)
+        pid = (uint16_t)((pid >> 8) | (pid << 8));
+
+    bool extended = (pid & PID_MASK) == (PID_EXTENDED & PID_MASK);
+    size_t valueStart = position + (extended ? 12 : 4);
+    size_t length = (m_currentPosition - m_cdrBuffer.begin()) - valueStart;
+    size_t padding = (4 - (length % 4)) & 3;
+
+    if(!extended && length + padding > 0xffff)
+        throw BadParamException("Parameter too long for its header in Cdr::endSerializeParameter");
+
+    if(padding > 0)
+    {
+        if(((m_lastPosition - m_currentPosition) < padding) && !resize(padding))
+            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+        memset(&m_currentPosition, 0, padding);
+        m_currentPosition += padding;
+        length += padding;
+    }
+
+    if(extended)
+        patchLength(position + 8, (uint32_t)length);
+    else
+        patchShortLength(position + 2, (uint16_t)length);
+
+    m_lastDataSize = 0;
+    resetAlignment();
+    return *this;
+}
+
+Cdr& Cdr::serializeParameterSentinel()
+{
+    state state(*this);
+
+    try
+    {
+        serialize(PID_SENTINEL);
+        serialize((uint16_t)0);
+    }
+    catch(Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+Cdr& Cdr::deserializeParameterHeader(uint32_t &pid, size_t &length)
+{
+    state state(*this);
+    uint16_t shortPid = 0, shortLength = 0;
+
+    try
+    {
+        deserialize(shortPid);
+        deserialize(shortLength);
+
+        if((shortPid & PID_MASK) == (PID_EXTENDED & PID_MASK))
+        {
+            uint32_t extendedLength = 0;
+            deserialize(pid);
+            deserialize(extendedLength);
+            length = extendedLength;
+        }
+        else
+        {
+            pid = shortPid;
+            length = shortLength;
+        }
+    }
+    catch(Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    resetAlignment();
+    return *this;
+}
+
+void Cdr::patchShortLength(size_t position, uint16_t length)
+{
+    const char *src = reinterpret_cast<const char*>(&length);
+    char *dst = m_cdrBuffer.getBuffer() + position;
+
+    if(m_swapBytes)
+    {
+        dst[0] = src[1];
+        dst[1] = src[0];
+    }
+    else
+    {
+        memcpy(dst, src, sizeof(length));
+    }
+}
+
+void Cdr::patchLength(size_t position, uint32_t length)
+{
+    const char *src = reinterpret_cast<const char*>(&length);
+    char *dst = m_cdrBuffer.getBuffer() + position;
+
+    if(m_swapBytes)
+    {
+        dst[0] = src[3];
+        dst[1] = src[2];
+        dst[2] = src[1];
+        dst[3] = src[0];
+    }
+    else
+    {
+        memcpy(dst, src, sizeof(length));
+    }
+}
+
+void Cdr::parallelCopy(char *dst, const char *src, size_t totalSize, size_t dataSize)
+{
+    const bool swapBytes = m_swapBytes;
+    const size_t numChunks = (totalSize + PARALLEL_COPY_CHUNK - 1) / PARALLEL_COPY_CHUNK;
+
+    m_threadPool->parallelFor(numChunks, [=](size_t chunk)
+            {
+                size_t offset = chunk * PARALLEL_COPY_CHUNK;
+                size_t size = totalSize - offset < PARALLEL_COPY_CHUNK ? totalSize - offset : PARALLEL_COPY_CHUNK;
+
+                if(!swapBytes)
+                    memcpy(dst + offset, src + offset, size);
+                else if(dataSize == 2)
+                    swapCopy<2>(dst + offset, src + offset, size);
+                else if(dataSize == 4)
+                    swapCopy<4>(dst + offset, src + offset, size);
+                else
+                    swapCopy<8>(dst + offset, src + offset, size);
+            });
+}
+
 bool Cdr::resize(size_t minSizeInc)
 {
     if(m_cdrBuffer.resize(minSizeInc))
@@ -665,14 +1061,8 @@ Cdr& Cdr::serializeArray(const bool *bool_t, size_t numElements)
         // Save last datasize.
         m_lastDataSize = sizeof(*bool_t);
 
-        for(size_t count = 0; count < numElements; ++count)
-        {
-            uint8_t value = 0;
-
-            if(bool_t[count])
-                value = 1;
-            m_currentPosition++ << value;
-        }
+        BoolPacking::toBytes(bool_t, numElements, &m_currentPosition);
+        m_currentPosition += numElements;
 
         return *this;
     }
@@ -712,9 +1102,14 @@ Cdr& Cdr::serializeArray(const int16_t *short_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            const char *dst = reinterpret_cast<const char*>(&short_t);
+            parallelCopy(&m_currentPosition, reinterpret_cast<const char*>(short_t), totalSize, sizeof(*short_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            const char *dst = reinterpret_cast<const char*>(short_t);
             const char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*short_t))
@@ -769,9 +1164,14 @@ Cdr& Cdr::serializeArray(const int32_t *long_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            const char *dst = reinterpret_cast<const char*>(&long_t);
+            parallelCopy(&m_currentPosition, reinterpret_cast<const char*>(long_t), totalSize, sizeof(*long_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            const char *dst = reinterpret_cast<const char*>(long_t);
             const char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*long_t))
@@ -854,9 +1254,14 @@ Cdr& Cdr::serializeArray(const int64_t *longlong_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            const char *dst = reinterpret_cast<const char*>(&longlong_t);
+            parallelCopy(&m_currentPosition, reinterpret_cast<const char*>(longlong_t), totalSize, sizeof(*longlong_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            const char *dst = reinterpret_cast<const char*>(longlong_t);
             const char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*longlong_t))
@@ -917,9 +1322,14 @@ Cdr& Cdr::serializeArray(const float *float_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            const char *dst = reinterpret_cast<const char*>(&float_t);
+            parallelCopy(&m_currentPosition, reinterpret_cast<const char*>(float_t), totalSize, sizeof(*float_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            const char *dst = reinterpret_cast<const char*>(float_t);
             const char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*float_t))
@@ -976,9 +1386,14 @@ Cdr& Cdr::serializeArray(const double *double_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            const char *dst = reinterpret_cast<const char*>(&double_t);
+            parallelCopy(&m_currentPosition, reinterpret_cast<const char*>(double_t), totalSize, sizeof(*double_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            const char *dst = reinterpret_cast<const char*>(double_t);
             const char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*double_t))
@@ -1041,7 +1456,7 @@ Cdr& Cdr::serializeArray(const long double *ldouble_t, size_t numElements)
 
         if(m_swapBytes)
         {
-            const char *dst = reinterpret_cast<const char*>(&ldouble_t);
+            const char *dst = reinterpret_cast<const char*>(ldouble_t);
             const char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*ldouble_t))
@@ -1544,23 +1959,13 @@ Cdr& Cdr::deserializeArray(bool *bool_t, size_t numElements)
 
     if((m_lastPosition - m_currentPosition) >= totalSize)
     {
+        if(!BoolPacking::fromBytes(&m_currentPosition, numElements, bool_t))
+            throw BadParamException("Unexpected byte value in Cdr::deserializeArray(bool), expected 0 or 1");
+
         // Save last datasize.
         m_lastDataSize = sizeof(*bool_t);
 
-        for(size_t count = 0; count < numElements; ++count)
-        {
-            uint8_t value = 0;
-            m_currentPosition++ >> value;
-
-            if(value == 1)
-            {
-                bool_t[count] = true;
-            }
-            else if(value == 0)
-            {
-                bool_t[count] = false;
-            }
-        }
+        m_currentPosition += numElements;
 
         return *this;
     }
@@ -1600,9 +2005,14 @@ Cdr& Cdr::deserializeArray(int16_t *short_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            char *dst = reinterpret_cast<char*>(&short_t);
+            parallelCopy(reinterpret_cast<char*>(short_t), &m_currentPosition, totalSize, sizeof(*short_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            char *dst = reinterpret_cast<char*>(short_t);
             char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*short_t))
@@ -1657,9 +2067,14 @@ Cdr& Cdr::deserializeArray(int32_t *long_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            char *dst = reinterpret_cast<char*>(&long_t);
+            parallelCopy(reinterpret_cast<char*>(long_t), &m_currentPosition, totalSize, sizeof(*long_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            char *dst = reinterpret_cast<char*>(long_t);
             char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*long_t))
@@ -1746,9 +2161,14 @@ Cdr& Cdr::deserializeArray(int64_t *longlong_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            char *dst = reinterpret_cast<char*>(&longlong_t);
+            parallelCopy(reinterpret_cast<char*>(longlong_t), &m_currentPosition, totalSize, sizeof(*longlong_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            char *dst = reinterpret_cast<char*>(longlong_t);
             char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*longlong_t))
@@ -1809,9 +2229,14 @@ Cdr& Cdr::deserializeArray(float *float_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            char *dst = reinterpret_cast<char*>(&float_t);
+            parallelCopy(reinterpret_cast<char*>(float_t), &m_currentPosition, totalSize, sizeof(*float_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            char *dst = reinterpret_cast<char*>(float_t);
             char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*float_t))
@@ -1868,9 +2293,14 @@ Cdr& Cdr::deserializeArray(double *double_t, size_t numElements)
         if(numElements)
             makeAlign(align);
 
-        if(m_swapBytes)
+        if(m_threadPool != NULL && totalSize >= m_parallelThreshold)
         {
-            char *dst = reinterpret_cast<char*>(&double_t);
+            parallelCopy(reinterpret_cast<char*>(double_t), &m_currentPosition, totalSize, sizeof(*double_t));
+            m_currentPosition += totalSize;
+        }
+        else if(m_swapBytes)
+        {
+            char *dst = reinterpret_cast<char*>(double_t);
             char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*double_t))
@@ -1933,7 +2363,7 @@ Cdr& Cdr::deserializeArray(long double *ldouble_t, size_t numElements)
 
         if(m_swapBytes)
         {
-            char *dst = reinterpret_cast<char*>(&ldouble_t);
+            char *dst = reinterpret_cast<char*>(ldouble_t);
             char *end = dst + totalSize;
 
             for(; dst < end; dst += sizeof(*ldouble_t))
@@ -1992,15 +2422,8 @@ Cdr& Cdr::serializeBoolSequence(const std::vector<bool> &vector_t)
         // Save last datasize.
         m_lastDataSize = sizeof(bool);
 
-        for(size_t count = 0; count < vector_t.size(); ++count)
-        {
-            uint8_t value = 0;
-            std::vector<bool>::const_reference ref = vector_t[count];
-
-            if(ref)
-                value = 1;
-            m_currentPosition++ << value;
-        }
+        BoolPacking::toBytes(vector_t, &m_currentPosition);
+        m_currentPosition += totalSize;
     }
     else
     {
@@ -2018,35 +2441,466 @@ Cdr& Cdr::deserializeBoolSequence(std::vector<bool> &vector_t)
 
     *this >> seqLength;
 
-    vector_t.resize(seqLength);
     size_t totalSize = seqLength*sizeof(bool);
 
     if((m_lastPosition - m_currentPosition) >= totalSize)
     {
+        vector_t.resize(seqLength);
+
+        if(!BoolPacking::fromBytes(&m_currentPosition, vector_t))
+        {
+            setState(state);
+            throw BadParamException("Unexpected byte value in Cdr::deserializeBoolSequence, expected 0 or 1");
+        }
+
         // Save last datasize.
         m_lastDataSize = sizeof(bool);
 
-        for(uint32_t count = 0; count < seqLength; ++count)
+        m_currentPosition += totalSize;
+    }
+    else
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    return *this;
+}
+
+Cdr& Cdr::serializePackedBoolArray(const bool *bool_t, size_t numElements)
+{
+    size_t totalSize = BoolPacking::getPackedSize(numElements);
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        // Save last datasize.
+        m_lastDataSize = sizeof(uint8_t);
+
+        BoolPacking::pack(bool_t, numElements, &m_currentPosition);
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+Cdr& Cdr::deserializePackedBoolArray(bool *bool_t, size_t numElements)
+{
+    size_t totalSize = BoolPacking::getPackedSize(numElements);
+
+    if((m_lastPosition - m_currentPosition) >= totalSize)
+    {
+        if(!BoolPacking::unpack(&m_currentPosition, numElements, bool_t))
+            throw BadParamException("Unexpected unused bits in Cdr::deserializePackedBoolArray, expected 0");
+
+        // Save last datasize.
+        m_lastDataSize = sizeof(uint8_t);
+
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+Cdr& Cdr::serializePackedBoolSequence(const std::vector<bool> &vector_t)
+{
+    state state(*this);
+
+    *this << (uint32_t)vector_t.size();
+
+    size_t totalSize = BoolPacking::getPackedSize(vector_t.size());
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        // Save last datasize.
+        m_lastDataSize = sizeof(uint8_t);
+
+        BoolPacking::pack(vector_t, &m_currentPosition);
+        m_currentPosition += totalSize;
+    }
+    else
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    return *this;
+}
+
+Cdr& Cdr::deserializePackedBoolSequence(std::vector<bool> &vector_t)
+{
+    uint32_t seqLength = 0;
+    state state(*this);
+
+    *this >> seqLength;
+
+    size_t totalSize = BoolPacking::getPackedSize(seqLength);
+
+    if((m_lastPosition - m_currentPosition) >= totalSize)
+    {
+        // Save last datasize.
+        m_lastDataSize = sizeof(uint8_t);
+
+        vector_t.resize(seqLength);
+
+        if(!BoolPacking::unpack(&m_currentPosition, vector_t))
+        {
+            setState(state);
+            throw BadParamException("Unexpected unused bits in Cdr::deserializePackedBoolSequence, expected 0");
+        }
+
+        m_currentPosition += totalSize;
+    }
+    else
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    return *this;
+}
+
+template<class _T>
+Cdr& Cdr::serializeCompressed(const _T *value_t, size_t numElements)
+{
+    state state(*this);
+    size_t position = beginSerializeDHeader();
+    size_t maxSize = TimeSeriesCodec::getMaxEncodedSize(numElements, sizeof(_T));
+
+    if(((m_lastPosition - m_currentPosition) >= maxSize) || resize(maxSize))
+    {
+        m_currentPosition += TimeSeriesCodec::encode(value_t, numElements, &m_currentPosition);
+    }
+    else
+    {
+        // A user buffer may hold the compressed array but not its worst case.
+        std::vector<char> encoded(maxSize);
+        size_t size = TimeSeriesCodec::encode(value_t, numElements, encoded.data());
+
+        if((m_lastPosition - m_currentPosition) < size)
         {
-            uint8_t value = 0;
-            m_currentPosition++ >> value;
+            setState(state);
+            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        }
+
+        m_currentPosition.memcopy(encoded.data(), size);
+        m_currentPosition += size;
+    }
+
+    // Save last datasize.
+    m_lastDataSize = sizeof(uint8_t);
+
+    return endSerializeDHeader(position);
+}
+
+template<class _T>
+Cdr& Cdr::deserializeCompressed(_T *value_t, size_t numElements)
+{
+    uint32_t size = 0;
+    state state(*this);
+
+    deserialize(size);
+
+    if((m_lastPosition - m_currentPosition) < size)
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    if(!TimeSeriesCodec::decode(&m_currentPosition, size, value_t, numElements))
+    {
+        setState(state);
+        throw BadParamException("Malformed compressed array in Cdr::deserializeCompressedArray");
+    }
+
+    // Save last datasize.
+    m_lastDataSize = sizeof(uint8_t);
+    m_currentPosition += size;
 
-            if(value == 1)
+    return *this;
+}
+
+Cdr& Cdr::serializeCompressedArray(const double *double_t, size_t numElements)
+{
+    return serializeCompressed(double_t, numElements);
+}
+
+Cdr& Cdr::serializeCompressedArray(const float *float_t, size_t numElements)
+{
+    return serializeCompressed(float_t, numElements);
+}
+
+Cdr& Cdr::serializeCompressedArray(const int64_t *longlong_t, size_t numElements)
+{
+    return serializeCompressed(longlong_t, numElements);
+}
+
+Cdr& Cdr::serializeCompressedArray(const uint64_t *ulonglong_t, size_t numElements)
+{
+    return serializeCompressed(ulonglong_t, numElements);
+}
+
+Cdr& Cdr::serializeCompressedArray(const int32_t *long_t, size_t numElements)
+{
+    return serializeCompressed(long_t, numElements);
+}
+
+Cdr& Cdr::serializeCompressedArray(const uint32_t *ulong_t, size_t numElements)
+{
+    return serializeCompressed(ulong_t, numElements);
+}
+
+Cdr& Cdr::deserializeCompressedArray(double *double_t, size_t numElements)
+{
+    return deserializeCompressed(double_t, numElements);
+}
+
+Cdr& Cdr::deserializeCompressedArray(float *float_t, size_t numElements)
+{
+    return deserializeCompressed(float_t, numElements);
+}
+
+Cdr& Cdr::deserializeCompressedArray(int64_t *longlong_t, size_t numElements)
+{
+    return deserializeCompressed(longlong_t, numElements);
+}
+
+Cdr& Cdr::deserializeCompressedArray(uint64_t *ulonglong_t, size_t numElements)
+{
+    return deserializeCompressed(ulonglong_t, numElements);
+}
+
+Cdr& Cdr::deserializeCompressedArray(int32_t *long_t, size_t numElements)
+{
+    return deserializeCompressed(long_t, numElements);
+}
+
+Cdr& Cdr::deserializeCompressedArray(uint32_t *ulong_t, size_t numElements)
+{
+    return deserializeCompressed(ulong_t, numElements);
+}
+
+template<class _T>
+Cdr& Cdr::serializeHalf(const _T *value_t, size_t numElements)
+{
+    uint16_t block[CODEC_BLOCK];
+    state state(*this);
+
+    try
+    {
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+            QuantizationCodec::toHalf(value_t + count, blockSize, block);
+            serializeArray(block, blockSize);
+        }
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+template<class _T>
+Cdr& Cdr::deserializeHalf(_T *value_t, size_t numElements)
+{
+    uint16_t block[CODEC_BLOCK];
+    state state(*this);
+
+    try
+    {
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+            deserializeArray(block, blockSize);
+            QuantizationCodec::fromHalf(block, blockSize, value_t + count);
+        }
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+template<class _T>
+Cdr& Cdr::serializeQuantized(const _T *value_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    float offset = 0, scale = 0;
+    state state(*this);
+
+    QuantizationCodec::getRange(value_t, numElements, quantization, offset, scale);
+
+    try
+    {
+        serialize(offset);
+        serialize(scale);
+
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+
+            if(quantization == QuantizationCodec::QUANTIZATION_8_BITS)
             {
-                vector_t[count] = true;
+                uint8_t block[CODEC_BLOCK];
+                QuantizationCodec::quantize(value_t + count, blockSize, offset, scale, block);
+                serializeArray(block, blockSize);
             }
-            else if(value == 0)
+            else
             {
-                vector_t[count] = false;
-            } else {
-                throw BadParamException("Unexpected byte value in Cdr::deserializeBoolSequence, expected 0 or 1");
+                uint16_t block[CODEC_BLOCK];
+                QuantizationCodec::quantize(value_t + count, blockSize, offset, scale, block);
+                serializeArray(block, blockSize);
             }
         }
     }
-    else
+    catch(eprosima::fastcdr::exception::Exception &ex)
     {
         setState(state);
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+template<class _T>
+Cdr& Cdr::deserializeQuantized(_T *value_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    float offset = 0, scale = 0;
+    state state(*this);
+
+    try
+    {
+        deserialize(offset);
+        deserialize(scale);
+
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+
+            if(quantization == QuantizationCodec::QUANTIZATION_8_BITS)
+            {
+                uint8_t block[CODEC_BLOCK];
+                deserializeArray(block, blockSize);
+                QuantizationCodec::dequantize(block, blockSize, offset, scale, value_t + count);
+            }
+            else
+            {
+                uint16_t block[CODEC_BLOCK];
+                deserializeArray(block, blockSize);
+                QuantizationCodec::dequantize(block, blockSize, offset, scale, value_t + count);
+            }
+        }
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+Cdr& Cdr::serializeHalfArray(const float *float_t, size_t numElements)
+{
+    return serializeHalf(float_t, numElements);
+}
+
+Cdr& Cdr::serializeHalfArray(const double *double_t, size_t numElements)
+{
+    return serializeHalf(double_t, numElements);
+}
+
+Cdr& Cdr::deserializeHalfArray(float *float_t, size_t numElements)
+{
+    return deserializeHalf(float_t, numElements);
+}
+
+Cdr& Cdr::deserializeHalfArray(double *double_t, size_t numElements)
+{
+    return deserializeHalf(double_t, numElements);
+}
+
+Cdr& Cdr::serializeQuantizedArray(const float *float_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return serializeQuantized(float_t, numElements, quantization);
+}
+
+Cdr& Cdr::serializeQuantizedArray(const double *double_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return serializeQuantized(double_t, numElements, quantization);
+}
+
+Cdr& Cdr::deserializeQuantizedArray(float *float_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return deserializeQuantized(float_t, numElements, quantization);
+}
+
+Cdr& Cdr::deserializeQuantizedArray(double *double_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return deserializeQuantized(double_t, numElements, quantization);
+}
+
+Cdr& Cdr::serializeDictionaryString(const char *string_t, StringDictionary &dictionary)
+{
+    // A null string shares the entry of the empty string.
+    const char *key = string_t != nullptr ? string_t : "";
+    size_t length = strlen(key);
+    uint32_t reference = dictionary.find(key, length);
+
+    if(reference != 0)
+        return serialize(reference);
+
+    state state(*this);
+
+    try
+    {
+        serialize(reference);
+        serialize(string_t);
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    // Added only once the string is in the buffer, so the dictionary does not get ahead of the stream.
+    dictionary.add(key, length);
+
+    return *this;
+}
+
+Cdr& Cdr::deserializeDictionaryString(StringDictionary::View &view_t, StringDictionary &dictionary)
+{
+    uint32_t reference = 0;
+    state state(*this);
+
+    try
+    {
+        deserialize(reference);
+
+        if(reference == 0)
+        {
+            uint32_t length = 0;
+            const char *str = readString(length);
+            dictionary.addView(str, length);
+            view_t = StringDictionary::View(str, length);
+        }
+        else
+            view_t = dictionary.getView(reference);
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
     }
 
     return *this;
@@ -2077,3 +2931,70 @@ Cdr& Cdr::deserializeStringSequence(std::string *&sequence_t, size_t &numElement
     numElements = seqLength;
     return *this;
 }
+
+size_t Cdr::getRecordLayout(size_t position, const size_t *sizes, size_t numMembers, size_t *offsets) const
+{
+    size_t start = position;
+
+    for(size_t member = 0; member < numMembers; ++member)
+    {
+        position += alignment(position, sizes[member] < m_maxAlignment ? sizes[member] : m_maxAlignment);
+        offsets[member] = position - start;
+        position += sizes[member];
+    }
+
+    return position;
+}
+
+void Cdr::deserializeColumns(const size_t *sizes, size_t numMembers, void *const *columns, size_t numElements)
+{
+    for(size_t member = 0; member < numMembers; ++member)
+    {
+        if(sizes[member] != 1 && sizes[member] != 2 && sizes[member] != 4 && sizes[member] != 8)
+            throw BadParamException("Unsupported member size in Cdr::deserializeSequenceColumns");
+    }
+
+    std::vector<size_t> offsets(numMembers);
+    std::vector<void*> records(columns, columns + numMembers);
+    char *origin = &m_alignPosition;
+    size_t position = m_currentPosition - m_alignPosition;
+    size_t available = m_lastPosition - m_alignPosition;
+    size_t maxAlignment = 1;
+
+    for(size_t member = 0; member < numMembers; ++member)
+    {
+        if(sizes[member] > maxAlignment)
+            maxAlignment = sizes[member];
+    }
+
+    if(maxAlignment > m_maxAlignment)
+        maxAlignment = m_maxAlignment;
+
+    // Once a record starts at the same alignment as the previous one, all the remaining records have the same layout.
+    // That happens from the second record at most, because the end of a record only depends on its most aligned member.
+    for(size_t count = 0; count < numElements;)
+    {
+        size_t end = getRecordLayout(position, sizes, numMembers, &offsets[0]);
+        size_t stride = end - position;
+        size_t numRecords = (stride % maxAlignment == 0) ? numElements - count : 1;
+
+        if(available < position || (available - position) / stride < numRecords)
+            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+        ColumnTransposer::transpose(origin + position, numRecords, stride, &offsets[0], sizes, numMembers, &records[0], m_swapBytes);
+
+        for(size_t member = 0; member < numMembers; ++member)
+            records[member] = static_cast<char*>(records[member]) + numRecords * sizes[member];
+
+        position += numRecords * stride;
+        count += numRecords;
+    }
+
+    if(numElements > 0)
+    {
+        m_currentPosition += position - (m_currentPosition - m_alignPosition);
+
+        // Save last datasize.
+        m_lastDataSize = sizes[numMembers - 1];
+    }
+}
@@ -0,0 +1,195 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/ColumnTransposer.h>
+
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FASTCDR_COLUMNTRANSPOSER_SSE2
+#endif
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    // Records copied member after member, so the block stays in the cache between members.
+    const size_t TRANSPOSE_BLOCK = 256;
+
+    inline uint16_t byteSwap(uint16_t value)
+    {
+        return (uint16_t)((value << 8) | (value >> 8));
+    }
+
+    inline uint32_t byteSwap(uint32_t value)
+    {
+#if defined(__GNUC__)
+        return __builtin_bswap32(value);
+#else
+        return (value << 24) | ((value << 8) & 0xff0000) | ((value >> 8) & 0xff00) | (value >> 24);
+#endif
+    }
+
+    inline uint64_t byteSwap(uint64_t value)
+    {
+#if defined(__GNUC__)
+        return __builtin_bswap64(value);
+#else
+        return ((uint64_t)byteSwap((uint32_t)value) << 32) | byteSwap((uint32_t)(value >> 32));
+#endif
+    }
+
+    inline uint8_t byteSwap(uint8_t value)
+    {
+        return value;
+    }
+
+    template<class _T>
+        void copyMember(const char *source, size_t numRecords, size_t stride, _T *column, bool swapBytes)
+        {
+            _T value;
+
+            if(swapBytes)
+            {
+                for(size_t count = 0; count < numRecords; ++count, source += stride)
+                {
+                    memcpy(&value, source, sizeof(value));
+                    column[count] = byteSwap(value);
+                }
+            }
+            else
+            {
+                for(size_t count = 0; count < numRecords; ++count, source += stride)
+                {
+                    memcpy(&value, source, sizeof(value));
+                    column[count] = value;
+                }
+            }
+        }
+
+    void copyMember(const char *source, size_t numRecords, size_t stride, size_t size, char *column, bool swapBytes)
+    {
+        switch(size)
+        {
+            case 1:
+                copyMember(source, numRecords, stride, reinterpret_cast<uint8_t*>(column), false);
+                break;
+            case 2:
+                copyMember(source, numRecords, stride, reinterpret_cast<uint16_t*>(column), swapBytes);
+                break;
+            case 4:
+                copyMember(source, numRecords, stride, reinterpret_cast<uint32_t*>(column), swapBytes);
+                break;
+            case 8:
+                copyMember(source, numRecords, stride, reinterpret_cast<uint64_t*>(column), swapBytes);
+                break;
+        }
+    }
+
+#ifdef FASTCDR_COLUMNTRANSPOSER_SSE2
+    inline __m128 swapWords(__m128 value, bool swapBytes)
+    {
+        if(!swapBytes)
+            return value;
+
+        __m128i word = _mm_castps_si128(value);
+        word = _mm_or_si128(_mm_slli_epi16(word, 8), _mm_srli_epi16(word, 8));
+        word = _mm_shufflehi_epi16(_mm_shufflelo_epi16(word, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm_castsi128_ps(word);
+    }
+
+    inline __m128 load(const char *source)
+    {
+        return _mm_loadu_ps(reinterpret_cast<const float*>(source));
+    }
+
+    inline void store(void *column, size_t count, __m128 value, bool swapBytes)
+    {
+        _mm_storeu_ps(static_cast<float*>(column) + count, swapWords(value, swapBytes));
+    }
+
+    // Transposes packed records of 4 bytes members four records at a time. Returns the number of records transposed.
+    size_t transposeWords(const char *source, size_t numRecords, size_t numMembers, void *const *columns, bool swapBytes)
+    {
+        size_t count = 0;
+
+        if(numMembers == 2)
+        {
+            for(; count + 4 <= numRecords; count += 4, source += 32)
+            {
+                __m128 a = load(source), b = load(source + 16);
+                store(columns[0], count, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), swapBytes);
+                store(columns[1], count, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)), swapBytes);
+            }
+        }
+        else if(numMembers == 3)
+        {
+            for(; count + 4 <= numRecords; count += 4, source += 48)
+            {
+                // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+                __m128 a = load(source), b = load(source + 16), c = load(source + 32);
+                __m128 x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 1, 0, 2)),
+                        _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 2, 0, 3)),
+                        _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 1, 0, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 3, 0, 0)),
+                        _MM_SHUFFLE(2, 0, 2, 0));
+                store(columns[0], count, x, swapBytes);
+                store(columns[1], count, y, swapBytes);
+                store(columns[2], count, z, swapBytes);
+            }
+        }
+        else if(numMembers == 4)
+        {
+            for(; count + 4 <= numRecords; count += 4, source += 64)
+            {
+                __m128 a = load(source), b = load(source + 16), c = load(source + 32), d = load(source + 48);
+                _MM_TRANSPOSE4_PS(a, b, c, d);
+                store(columns[0], count, a, swapBytes);
+                store(columns[1], count, b, swapBytes);
+                store(columns[2], count, c, swapBytes);
+                store(columns[3], count, d, swapBytes);
+            }
+        }
+
+        return count;
+    }
+#endif
+}
+
+void ColumnTransposer::transpose(const char *source, size_t numRecords, size_t stride, const size_t *offsets, const size_t *sizes,
+        size_t numMembers, void *const *columns, bool swapBytes)
+{
+    size_t count = 0;
+
+#ifdef FASTCDR_COLUMNTRANSPOSER_SSE2
+    bool packedWords = numMembers >= 2 && numMembers <= 4 && stride == numMembers * sizeof(uint32_t);
+
+    for(size_t member = 0; packedWords && member < numMembers; ++member)
+        packedWords = sizes[member] == sizeof(uint32_t) && offsets[member] == member * sizeof(uint32_t);
+
+    if(packedWords)
+        count = transposeWords(source, numRecords, numMembers, columns, swapBytes);
+#endif
+
+    for(; count < numRecords; count += TRANSPOSE_BLOCK)
+    {
+        size_t blockSize = numRecords - count < TRANSPOSE_BLOCK ? numRecords - count : TRANSPOSE_BLOCK;
+        const char *block = source + count * stride;
+
+        for(size_t member = 0; member < numMembers; ++member)
+            copyMember(block + offsets[member], blockSize, stride, sizes[member], static_cast<char*>(columns[member]) + count * sizes[member],
+                    swapBytes);
+    }
+}
@@ -0,0 +1,199 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/ColumnarBatch.h>
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+namespace
+{
+    // The size is a template parameter, so each copy is a single load and store.
+    template<size_t _Size>
+        void gatherField(const char *field, size_t stride, size_t numObjects, char *array)
+        {
+            for(size_t count = 0; count < numObjects; ++count, field += stride, array += _Size)
+                memcpy(array, field, _Size);
+        }
+
+    template<size_t _Size>
+        void scatterField(const char *array, size_t numObjects, size_t stride, char *field)
+        {
+            for(size_t count = 0; count < numObjects; ++count, array += _Size, field += stride)
+                memcpy(field, array, _Size);
+        }
+}
+
+ColumnLayout::ColumnLayout(size_t objectSize) : m_objectSize(objectSize)
+{
+}
+
+ColumnLayout& ColumnLayout::addColumn(size_t offset, ColumnType type, Codec codec)
+{
+    bool supported = false;
+
+    switch(codec)
+    {
+        case CODEC_NONE:
+            supported = true;
+            break;
+        case CODEC_COMPRESSED:
+            supported = type == COLUMN_LONG || type == COLUMN_ULONG || type == COLUMN_LONGLONG || type == COLUMN_ULONGLONG ||
+                type == COLUMN_FLOAT || type == COLUMN_DOUBLE;
+            break;
+        case CODEC_HALF:
+        case CODEC_QUANTIZED_8_BITS:
+        case CODEC_QUANTIZED_16_BITS:
+            supported = type == COLUMN_FLOAT || type == COLUMN_DOUBLE;
+            break;
+        case CODEC_PACKED:
+            supported = type == COLUMN_BOOLEAN;
+            break;
+    }
+
+    if(!supported)
+        throw BadParamException("Codec not supported by the column type");
+
+    if(offset + getElementSize(type) > m_objectSize)
+        throw BadParamException("Column out of the structure");
+
+    Column column;
+    column.offset = offset;
+    column.type = type;
+    column.codec = codec;
+    m_columns.push_back(column);
+
+    return *this;
+}
+
+size_t ColumnLayout::getElementSize(ColumnType type)
+{
+    switch(type)
+    {
+        case COLUMN_CHAR:
+            return sizeof(char);
+        case COLUMN_OCTET:
+            return sizeof(uint8_t);
+        case COLUMN_SHORT:
+        case COLUMN_USHORT:
+            return sizeof(int16_t);
+        case COLUMN_LONG:
+        case COLUMN_ULONG:
+            return sizeof(int32_t);
+        case COLUMN_LONGLONG:
+        case COLUMN_ULONGLONG:
+            return sizeof(int64_t);
+        case COLUMN_FLOAT:
+            return sizeof(float);
+        case COLUMN_DOUBLE:
+            return sizeof(double);
+        case COLUMN_BOOLEAN:
+            return sizeof(bool);
+    }
+
+    throw BadParamException("Unknown column type");
+}
+
+size_t ColumnLayout::getMinimumEncodedBits(const Column &column)
+{
+    switch(column.codec)
+    {
+        case CODEC_COMPRESSED:
+        case CODEC_PACKED:
+            return 1;
+        case CODEC_QUANTIZED_8_BITS:
+            return 8;
+        case CODEC_HALF:
+        case CODEC_QUANTIZED_16_BITS:
+            return 16;
+        default:
+            break;
+    }
+
+    // The compact mode of eprosima::fastcdr::FastCdr writes 32 and 64 bits integers as variable length integers of one byte or more.
+    switch(column.type)
+    {
+        case COLUMN_LONG:
+        case COLUMN_ULONG:
+        case COLUMN_LONGLONG:
+        case COLUMN_ULONGLONG:
+            return 8;
+        default:
+            return getElementSize(column.type) * 8;
+    }
+}
+
+void ColumnLayout::gather(const void *objects, size_t numObjects, size_t column, void *array) const
+{
+    const char *field = static_cast<const char*>(objects) + m_columns[column].offset;
+    char *destination = static_cast<char*>(array);
+
+    switch(getElementSize(m_columns[column].type))
+    {
+        case 1:
+            gatherField<1>(field, m_objectSize, numObjects, destination);
+            break;
+        case 2:
+            gatherField<2>(field, m_objectSize, numObjects, destination);
+            break;
+        case 4:
+            gatherField<4>(field, m_objectSize, numObjects, destination);
+            break;
+        case 8:
+            gatherField<8>(field, m_objectSize, numObjects, destination);
+            break;
+    }
+}
+
+void ColumnLayout::scatter(const void *array, size_t numObjects, size_t column, void *objects) const
+{
+    const char *source = static_cast<const char*>(array);
+    char *field = static_cast<char*>(objects) + m_columns[column].offset;
+
+    switch(getElementSize(m_columns[column].type))
+    {
+        case 1:
+            scatterField<1>(source, numObjects, m_objectSize, field);
+            break;
+        case 2:
+            scatterField<2>(source, numObjects, m_objectSize, field);
+            break;
+        case 4:
+            scatterField<4>(source, numObjects, m_objectSize, field);
+            break;
+        case 8:
+            scatterField<8>(source, numObjects, m_objectSize, field);
+            break;
+    }
+}
+
+ColumnarBatch::ColumnarBatch() : m_layout(NULL), m_numObjects(0)
+{
+}
+
+void ColumnarBatch::checkColumn(size_t column, ColumnLayout::ColumnType type) const
+{
+    if(m_layout == NULL || column >= m_columns.size())
+        throw BadParamException("Unknown column");
+
+    if(m_layout->getColumns()[column].type != type)
+        throw BadParamException("Column type mismatch");
+}
+
+void* ColumnarBatch::allocateColumn(size_t column, size_t size)
+{
+    std::vector<uint64_t> &storage = m_storage[column];
+    storage.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    return storage.data();
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <fastcdr/FastBuffer.h>
+#include <fastcdr/exceptions/BadParamException.h>
 
 #if !__APPLE__
 #include <malloc.h>
@@ -25,15 +26,60 @@
 using namespace eprosima::fastcdr;
 
 FastBuffer::FastBuffer() : m_buffer(NULL),
-    m_bufferSize(0), m_internalBuffer(true)
+    m_bufferSize(0), m_headroom(0), m_tailroom(0), m_internalBuffer(true)
 {
 }
 
 FastBuffer::FastBuffer(char* const buffer, const size_t bufferSize) : m_buffer(buffer),
-    m_bufferSize(bufferSize), m_internalBuffer(false)
+    m_bufferSize(bufferSize), m_headroom(0), m_tailroom(0), m_internalBuffer(false)
 {
 }
 
+FastBuffer::FastBuffer(char* const buffer, const size_t bufferSize, const size_t headroom, const size_t tailroom) : m_buffer(buffer),
+    m_bufferSize(bufferSize), m_headroom(headroom), m_tailroom(tailroom), m_internalBuffer(false)
+{
+    if(headroom > bufferSize || tailroom > bufferSize - headroom)
+        throw eprosima::fastcdr::exception::BadParamException("Headroom and tailroom exceed the buffer size in FastBuffer::FastBuffer");
+}
+
+#if HAVE_CXX0X
+FastBuffer::FastBuffer(FastBuffer &&buffer) : m_buffer(buffer.m_buffer),
+    m_bufferSize(buffer.m_bufferSize), m_headroom(buffer.m_headroom), m_tailroom(buffer.m_tailroom),
+    m_internalBuffer(buffer.m_internalBuffer)
+{
+    buffer.m_buffer = NULL;
+    buffer.m_bufferSize = 0;
+    buffer.m_headroom = 0;
+    buffer.m_tailroom = 0;
+    buffer.m_internalBuffer = true;
+}
+
+FastBuffer& FastBuffer::operator=(FastBuffer &&buffer)
+{
+    if(this != &buffer)
+    {
+        if(m_internalBuffer && m_buffer != NULL)
+        {
+            free(m_buffer);
+        }
+
+        m_buffer = buffer.m_buffer;
+        m_bufferSize = buffer.m_bufferSize;
+        m_headroom = buffer.m_headroom;
+        m_tailroom = buffer.m_tailroom;
+        m_internalBuffer = buffer.m_internalBuffer;
+
+        buffer.m_buffer = NULL;
+        buffer.m_bufferSize = 0;
+        buffer.m_headroom = 0;
+        buffer.m_tailroom = 0;
+        buffer.m_internalBuffer = true;
+    }
+
+    return *this;
+}
+#endif
+
 FastBuffer::~FastBuffer()
 {
     if(m_internalBuffer && m_buffer != NULL)
@@ -42,6 +88,59 @@ FastBuffer::~FastBuffer()
     }
 }
 
+void FastBuffer::setBuffer(char* const buffer, const size_t bufferSize)
+{
+    if(m_internalBuffer && m_buffer != NULL)
+    {
+        free(m_buffer);
+    }
+
+    m_buffer = buffer;
+    m_bufferSize = bufferSize;
+    m_headroom = 0;
+    m_tailroom = 0;
+    m_internalBuffer = false;
+}
+
+bool FastBuffer::setRoom(size_t headroom, size_t tailroom)
+{
+    if(m_buffer != NULL && (headroom > m_bufferSize || tailroom > m_bufferSize - headroom))
+    {
+        return false;
+    }
+
+    m_headroom = headroom;
+    m_tailroom = tailroom;
+    return true;
+}
+
+void FastBuffer::adopt(char* const buffer, const size_t bufferSize)
+{
+    if(m_internalBuffer && m_buffer != NULL && m_buffer != buffer)
+    {
+        free(m_buffer);
+    }
+
+    m_buffer = buffer;
+    m_bufferSize = buffer != NULL ? bufferSize : 0;
+    m_headroom = 0;
+    m_tailroom = 0;
+    m_internalBuffer = true;
+}
+
+char* FastBuffer::release()
+{
+    if(!m_internalBuffer)
+    {
+        return NULL;
+    }
+
+    char *buffer = m_buffer;
+    m_buffer = NULL;
+    m_bufferSize = 0;
+    return buffer;
+}
+
 bool FastBuffer::resize(size_t minSizeInc)
 {
     size_t incBufferSize = BUFFER_START_LENGTH;
@@ -55,7 +154,7 @@ bool FastBuffer::resize(size_t minSizeInc)
 
         if(m_buffer == NULL)
         {
-            m_bufferSize = incBufferSize;
+            m_bufferSize = m_headroom + incBufferSize + m_tailroom;
 
             m_buffer = (char*)malloc(m_bufferSize);
 
@@ -79,3 +178,48 @@ bool FastBuffer::resize(size_t minSizeInc)
 
     return false;
 }
+
+bool FastBuffer::reserve(size_t size)
+{
+    size_t currentSize = getBufferSize();
+
+    if(currentSize >= size)
+    {
+        return true;
+    }
+
+    return resize(size - currentSize);
+}
+
+bool FastBuffer::shrink(size_t size)
+{
+    if(!m_internalBuffer)
+    {
+        return false;
+    }
+
+    if(m_buffer == NULL || getBufferSize() <= size)
+    {
+        return true;
+    }
+
+    if(size == 0)
+    {
+        free(m_buffer);
+        m_buffer = NULL;
+        m_bufferSize = 0;
+        return true;
+    }
+
+    size_t bufferSize = m_headroom + size + m_tailroom;
+    char *buffer = (char*)realloc(m_buffer, bufferSize);
+
+    // A failed realloc() leaves the stream as it was, which is still valid.
+    if(buffer != NULL)
+    {
+        m_buffer = buffer;
+        m_bufferSize = bufferSize;
+    }
+
+    return true;
+}
@@ -13,17 +13,240 @@
 // limitations under the License.
 
 #include <fastcdr/FastCdr.h>
+#include <fastcdr/BoolPacking.h>
+#include <fastcdr/TimeSeriesCodec.h>
 #include <fastcdr/exceptions/BadParamException.h>
 #include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 using namespace eprosima::fastcdr;
 using namespace ::exception;
 
+namespace
+{
+    const size_t MAX_VARINT_SIZE = 10;
+
+    const uint64_t VARINT_STOP_BITS = 0x8080808080808080ull;
+
+    const char* const VARINT_TOO_LONG_MESSAGE = "Variable length integer is too long";
+
+    const char* const VARINT_OUT_OF_RANGE_MESSAGE = "Variable length integer does not fit in the type";
+
+    // Number of elements converted at once by the lossy codecs.
+    const size_t CODEC_BLOCK = 256;
+
+    inline uint64_t zigzagEncode(int64_t value)
+    {
+        return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+    }
+
+    inline int64_t zigzagDecode(uint64_t value)
+    {
+        return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+    }
+
+    inline uint64_t toVarint(uint32_t value) { return value;}
+
+    inline uint64_t toVarint(uint64_t value) { return value;}
+
+    inline uint64_t toVarint(int32_t value) { return zigzagEncode(value);}
+
+    inline uint64_t toVarint(int64_t value) { return zigzagEncode(value);}
+
+    inline void fromVarint(uint64_t varint, uint32_t &value)
+    {
+        if(varint > 0xffffffffull)
+            throw BadParamException(VARINT_OUT_OF_RANGE_MESSAGE);
+
+        value = (uint32_t)varint;
+    }
+
+    inline void fromVarint(uint64_t varint, uint64_t &value)
+    {
+        value = varint;
+    }
+
+    inline void fromVarint(uint64_t varint, int32_t &value)
+    {
+        if(varint > 0xffffffffull)
+            throw BadParamException(VARINT_OUT_OF_RANGE_MESSAGE);
+
+        value = (int32_t)zigzagDecode(varint);
+    }
+
+    inline void fromVarint(uint64_t varint, int64_t &value)
+    {
+        value = zigzagDecode(varint);
+    }
+
+    inline size_t varintSize(uint64_t value)
+    {
+        size_t size = 1;
+
+        while(value >= 0x80)
+        {
+            value >>= 7;
+            ++size;
+        }
+
+        return size;
+    }
+
+    inline size_t encodeVarint(char *destination, uint64_t value)
+    {
+        size_t size = 0;
+
+        while(value >= 0x80)
+        {
+            destination[size++] = (char)(value | 0x80);
+            value >>= 7;
+        }
+
+        destination[size++] = (char)value;
+        return size;
+    }
+
+    // Returns the number of bytes of the variable length integer, or 0 if it is truncated.
+    size_t decodeVarint(const char *source, size_t available, uint64_t &value)
+    {
+        uint64_t result = 0;
+        size_t limit = available < MAX_VARINT_SIZE ? available : MAX_VARINT_SIZE;
+
+        for(size_t index = 0; index < limit; ++index)
+        {
+            uint8_t byte = (uint8_t)source[index];
+            result |= (uint64_t)(byte & 0x7f) << (7 * index);
+
+            if((byte & 0x80) == 0)
+            {
+                // The tenth byte only carries the most significant bit.
+                if(index == MAX_VARINT_SIZE - 1 && byte > 1)
+                    throw BadParamException(VARINT_OUT_OF_RANGE_MESSAGE);
+
+                value = result;
+                return index + 1;
+            }
+        }
+
+        if(limit == MAX_VARINT_SIZE)
+            throw BadParamException(VARINT_TOO_LONG_MESSAGE);
+
+        return 0;
+    }
+
+    inline uint64_t loadLittleEndian(const char *source)
+    {
+        uint64_t word;
+        memcpy(&word, source, sizeof(word));
+#if __BIG_ENDIAN__
+        word = ((word & 0x00000000ffffffffull) << 32) | ((word & 0xffffffff00000000ull) >> 32);
+        word = ((word & 0x0000ffff0000ffffull) << 16) | ((word & 0xffff0000ffff0000ull) >> 16);
+        word = ((word & 0x00ff00ff00ff00ffull) << 8) | ((word & 0xff00ff00ff00ff00ull) >> 8);
+#endif
+        return word;
+    }
+
+    inline size_t firstStopByte(uint64_t stops)
+    {
+#if defined(__GNUC__)
+        return (size_t)__builtin_ctzll(stops) / 8;
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, stops);
+        return (size_t)index / 8;
+#else
+        size_t index = 0;
+
+        while((stops & 0x80) == 0)
+        {
+            stops >>= 8;
+            ++index;
+        }
+
+        return index;
+#endif
+    }
+
+    /*
+     * Decodes numElements variable length integers. While eight bytes are available they are loaded in a word:
+     * eight one byte integers are decoded at once and an integer of up to eight bytes is decoded without a loop,
+     * packing its 7 bits groups with three shifts. Returns the number of bytes consumed.
+     */
+    template<class _T>
+        size_t decodeVarints(const char *source, size_t available, _T *value_t, size_t numElements)
+        {
+            size_t position = 0;
+            size_t count = 0;
+
+            while(count < numElements)
+            {
+                size_t remaining = available - position;
+
+                if(remaining < sizeof(uint64_t))
+                {
+                    uint64_t varint = 0;
+                    size_t size = decodeVarint(source + position, remaining, varint);
+
+                    if(size == 0)
+                        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                    fromVarint(varint, value_t[count++]);
+                    position += size;
+                    continue;
+                }
+
+                uint64_t word = loadLittleEndian(source + position);
+                uint64_t stops = ~word & VARINT_STOP_BITS;
+
+                if(stops == VARINT_STOP_BITS && numElements - count >= 8)
+                {
+                    for(size_t index = 0; index < 8; ++index)
+                        fromVarint((word >> (8 * index)) & 0x7f, value_t[count + index]);
+
+                    count += 8;
+                    position += 8;
+                }
+                else if(stops == 0)
+                {
+                    // Longer than eight bytes.
+                    uint64_t varint = 0;
+                    size_t size = decodeVarint(source + position, remaining, varint);
+
+                    if(size == 0)
+                        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                    fromVarint(varint, value_t[count++]);
+                    position += size;
+                }
+                else
+                {
+                    size_t size = firstStopByte(stops) + 1;
+
+                    if(size < 8)
+                        word &= (1ull << (8 * size)) - 1;
+
+                    word &= 0x7f7f7f7f7f7f7f7full;
+                    word = ((word & 0x7f007f007f007f00ull) >> 1) | (word & 0x007f007f007f007full);
+                    word = ((word & 0x3fff00003fff0000ull) >> 2) | (word & 0x00003fff00003fffull);
+                    word = ((word & 0x0fffffff00000000ull) >> 4) | (word & 0x000000000fffffffull);
+
+                    fromVarint(word, value_t[count++]);
+                    position += size;
+                }
+            }
+
+            return position;
+        }
+}
+
 FastCdr::state::state(const FastCdr &fastcdr) : m_currentPosition(fastcdr.m_currentPosition) {}
 
 FastCdr::state::state(const state &state) : m_currentPosition(state.m_currentPosition) {}
 
-FastCdr::FastCdr(FastBuffer &cdrBuffer) : m_cdrBuffer(cdrBuffer), m_currentPosition(cdrBuffer.begin()), m_lastPosition(cdrBuffer.end())
+FastCdr::FastCdr(FastBuffer &cdrBuffer) : m_cdrBuffer(cdrBuffer), m_currentPosition(cdrBuffer.begin()), m_lastPosition(cdrBuffer.end()),
+    m_compactIntegers(false)
 {
 }
 
@@ -58,6 +281,7 @@ void FastCdr::setState(FastCdr::state &state)
 void FastCdr::reset()
 {
     m_currentPosition = m_cdrBuffer.begin();
+    m_lastPosition = m_cdrBuffer.end();
 }
 
 bool FastCdr::resize(size_t minSizeInc)
@@ -123,14 +347,8 @@ FastCdr& FastCdr::serializeArray(const bool *bool_t, size_t numElements)
 
     if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
     {
-        for(size_t count = 0; count < numElements; ++count)
-        {
-            uint8_t value = 0;
-
-            if(bool_t[count])
-                value = 1;
-            m_currentPosition++ << value;
-        }
+        BoolPacking::toBytes(bool_t, numElements, &m_currentPosition);
+        m_currentPosition += numElements;
 
         return *this;
     }
@@ -169,6 +387,9 @@ FastCdr& FastCdr::serializeArray(const int16_t *short_t, size_t numElements)
 
 FastCdr& FastCdr::serializeArray(const int32_t *long_t, size_t numElements)
 {
+    if(m_compactIntegers)
+        return serializeVarintArray(long_t, numElements);
+
     size_t totalSize = sizeof(*long_t) * numElements;
 
     if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
@@ -191,6 +412,9 @@ FastCdr& FastCdr::serializeArray(const wchar_t *wchar, size_t numElements)
 
 FastCdr& FastCdr::serializeArray(const int64_t *longlong_t, size_t numElements)
 {
+    if(m_compactIntegers)
+        return serializeVarintArray(longlong_t, numElements);
+
     size_t totalSize = sizeof(*longlong_t) * numElements;
 
     if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
@@ -328,20 +552,10 @@ FastCdr& FastCdr::deserializeArray(bool *bool_t, size_t numElements)
 
     if((m_lastPosition - m_currentPosition) >= totalSize)
     {
-        for(size_t count = 0; count < numElements; ++count)
-        {
-            uint8_t value = 0;
-            m_currentPosition++ >> value;
+        if(!BoolPacking::fromBytes(&m_currentPosition, numElements, bool_t))
+            throw BadParamException("Unexpected byte value in FastCdr::deserializeArray(bool), expected 0 or 1");
 
-            if(value == 1)
-            {
-                bool_t[count] = true;
-            }
-            else if(value == 0)
-            {
-                bool_t[count] = false;
-            }
-        }
+        m_currentPosition += numElements;
 
         return *this;
     }
@@ -380,6 +594,9 @@ FastCdr& FastCdr::deserializeArray(int16_t *short_t, size_t numElements)
 
 FastCdr& FastCdr::deserializeArray(int32_t *long_t, size_t numElements)
 {
+    if(m_compactIntegers)
+        return deserializeVarintArray(long_t, numElements);
+
     size_t totalSize = sizeof(*long_t) * numElements;
 
     if((m_lastPosition - m_currentPosition) >= totalSize)
@@ -406,6 +623,9 @@ FastCdr& FastCdr::deserializeArray(wchar_t *wchar, size_t numElements)
 
 FastCdr& FastCdr::deserializeArray(int64_t *longlong_t, size_t numElements)
 {
+    if(m_compactIntegers)
+        return deserializeVarintArray(longlong_t, numElements);
+
     size_t totalSize = sizeof(*longlong_t) * numElements;
 
     if((m_lastPosition - m_currentPosition) >= totalSize)
@@ -468,21 +688,14 @@ FastCdr& FastCdr::serializeBoolSequence(const std::vector<bool> &vector_t)
 {
     state state(*this);
 
-    *this << (int32_t)vector_t.size();
+    *this << (uint32_t)vector_t.size();
 
     size_t totalSize = vector_t.size()*sizeof(bool);
 
     if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
     {
-        for(size_t count = 0; count < vector_t.size(); ++count)
-        {
-            uint8_t value = 0;
-            std::vector<bool>::const_reference ref = vector_t[count];
-
-            if(ref)
-                value = 1;
-            m_currentPosition++ << value;
-        }
+        BoolPacking::toBytes(vector_t, &m_currentPosition);
+        m_currentPosition += totalSize;
     }
     else
     {
@@ -500,30 +713,448 @@ FastCdr& FastCdr::deserializeBoolSequence(std::vector<bool> &vector_t)
 
     *this >> seqLength;
 
-    vector_t.resize(seqLength);
     size_t totalSize = seqLength*sizeof(bool);
 
     if((m_lastPosition - m_currentPosition) >= totalSize)
     {
-        for(uint32_t count = 0; count < seqLength; ++count)
+        vector_t.resize(seqLength);
+
+        if(!BoolPacking::fromBytes(&m_currentPosition, vector_t))
+        {
+            setState(state);
+            throw BadParamException("Unexpected byte value in FastCdr::deserializeBoolSequence, expected 0 or 1");
+        }
+
+        m_currentPosition += totalSize;
+    }
+    else
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    return *this;
+}
+
+FastCdr& FastCdr::serializePackedBoolArray(const bool *bool_t, size_t numElements)
+{
+    size_t totalSize = BoolPacking::getPackedSize(numElements);
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        BoolPacking::pack(bool_t, numElements, &m_currentPosition);
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::deserializePackedBoolArray(bool *bool_t, size_t numElements)
+{
+    size_t totalSize = BoolPacking::getPackedSize(numElements);
+
+    if((m_lastPosition - m_currentPosition) >= totalSize)
+    {
+        if(!BoolPacking::unpack(&m_currentPosition, numElements, bool_t))
+            throw BadParamException("Unexpected unused bits in FastCdr::deserializePackedBoolArray, expected 0");
+
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::serializePackedBoolSequence(const std::vector<bool> &vector_t)
+{
+    state state(*this);
+
+    *this << (uint32_t)vector_t.size();
+
+    size_t totalSize = BoolPacking::getPackedSize(vector_t.size());
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        BoolPacking::pack(vector_t, &m_currentPosition);
+        m_currentPosition += totalSize;
+    }
+    else
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    return *this;
+}
+
+FastCdr& FastCdr::deserializePackedBoolSequence(std::vector<bool> &vector_t)
+{
+    uint32_t seqLength = 0;
+    state state(*this);
+
+    *this >> seqLength;
+
+    size_t totalSize = BoolPacking::getPackedSize(seqLength);
+
+    if((m_lastPosition - m_currentPosition) >= totalSize)
+    {
+        vector_t.resize(seqLength);
+
+        if(!BoolPacking::unpack(&m_currentPosition, vector_t))
+        {
+            setState(state);
+            throw BadParamException("Unexpected unused bits in FastCdr::deserializePackedBoolSequence, expected 0");
+        }
+
+        m_currentPosition += totalSize;
+    }
+    else
+    {
+        setState(state);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    return *this;
+}
+
+template<class _T>
+FastCdr& FastCdr::serializeCompressed(const _T *value_t, size_t numElements)
+{
+    // The size is always 4 bytes, even in compact mode, so it can be written after the array.
+    size_t maxSize = sizeof(uint32_t) + TimeSeriesCodec::getMaxEncodedSize(numElements, sizeof(_T));
+    uint32_t size = 0;
+
+    if(((m_lastPosition - m_currentPosition) >= maxSize) || resize(maxSize))
+    {
+        char *destination = &m_currentPosition;
+        size = (uint32_t)TimeSeriesCodec::encode(value_t, numElements, destination + sizeof(size));
+        memcpy(destination, &size, sizeof(size));
+        m_currentPosition += sizeof(size) + size;
+
+        return *this;
+    }
+
+    // A user buffer may hold the compressed array but not its worst case.
+    std::vector<char> encoded(maxSize);
+    size = (uint32_t)TimeSeriesCodec::encode(value_t, numElements, encoded.data());
+
+    if((m_lastPosition - m_currentPosition) >= sizeof(size) + size)
+    {
+        m_currentPosition.memcopy(&size, sizeof(size));
+        m_currentPosition += sizeof(size);
+        m_currentPosition.memcopy(encoded.data(), size);
+        m_currentPosition += size;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+template<class _T>
+FastCdr& FastCdr::deserializeCompressed(_T *value_t, size_t numElements)
+{
+    uint32_t size = 0;
+
+    if((m_lastPosition - m_currentPosition) >= sizeof(size))
+    {
+        memcpy(&size, &m_currentPosition, sizeof(size));
+
+        if((m_lastPosition - m_currentPosition) - sizeof(size) >= size)
+        {
+            if(!TimeSeriesCodec::decode(&m_currentPosition + sizeof(size), size, value_t, numElements))
+                throw BadParamException("Malformed compressed array in FastCdr::deserializeCompressedArray");
+
+            m_currentPosition += sizeof(size) + size;
+
+            return *this;
+        }
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::serializeCompressedArray(const double *double_t, size_t numElements)
+{
+    return serializeCompressed(double_t, numElements);
+}
+
+FastCdr& FastCdr::serializeCompressedArray(const float *float_t, size_t numElements)
+{
+    return serializeCompressed(float_t, numElements);
+}
+
+FastCdr& FastCdr::serializeCompressedArray(const int64_t *longlong_t, size_t numElements)
+{
+    return serializeCompressed(longlong_t, numElements);
+}
+
+FastCdr& FastCdr::serializeCompressedArray(const uint64_t *ulonglong_t, size_t numElements)
+{
+    return serializeCompressed(ulonglong_t, numElements);
+}
+
+FastCdr& FastCdr::serializeCompressedArray(const int32_t *long_t, size_t numElements)
+{
+    return serializeCompressed(long_t, numElements);
+}
+
+FastCdr& FastCdr::serializeCompressedArray(const uint32_t *ulong_t, size_t numElements)
+{
+    return serializeCompressed(ulong_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeCompressedArray(double *double_t, size_t numElements)
+{
+    return deserializeCompressed(double_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeCompressedArray(float *float_t, size_t numElements)
+{
+    return deserializeCompressed(float_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeCompressedArray(int64_t *longlong_t, size_t numElements)
+{
+    return deserializeCompressed(longlong_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeCompressedArray(uint64_t *ulonglong_t, size_t numElements)
+{
+    return deserializeCompressed(ulonglong_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeCompressedArray(int32_t *long_t, size_t numElements)
+{
+    return deserializeCompressed(long_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeCompressedArray(uint32_t *ulong_t, size_t numElements)
+{
+    return deserializeCompressed(ulong_t, numElements);
+}
+
+template<class _T>
+FastCdr& FastCdr::serializeHalf(const _T *value_t, size_t numElements)
+{
+    uint16_t block[CODEC_BLOCK];
+    state state(*this);
+
+    try
+    {
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+            QuantizationCodec::toHalf(value_t + count, blockSize, block);
+            serializeArray(block, blockSize);
+        }
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+template<class _T>
+FastCdr& FastCdr::deserializeHalf(_T *value_t, size_t numElements)
+{
+    uint16_t block[CODEC_BLOCK];
+    state state(*this);
+
+    try
+    {
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
         {
-            uint8_t value = 0;
-            m_currentPosition++ >> value;
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+            deserializeArray(block, blockSize);
+            QuantizationCodec::fromHalf(block, blockSize, value_t + count);
+        }
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
 
-            if(value == 1)
+template<class _T>
+FastCdr& FastCdr::serializeQuantized(const _T *value_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    float offset = 0, scale = 0;
+    state state(*this);
+
+    QuantizationCodec::getRange(value_t, numElements, quantization, offset, scale);
+
+    try
+    {
+        serialize(offset);
+        serialize(scale);
+
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+
+            if(quantization == QuantizationCodec::QUANTIZATION_8_BITS)
             {
-                vector_t[count] = true;
+                uint8_t block[CODEC_BLOCK];
+                QuantizationCodec::quantize(value_t + count, blockSize, offset, scale, block);
+                serializeArray(block, blockSize);
             }
-            else if(value == 0)
+            else
             {
-                vector_t[count] = false;
+                uint16_t block[CODEC_BLOCK];
+                QuantizationCodec::quantize(value_t + count, blockSize, offset, scale, block);
+                serializeArray(block, blockSize);
             }
         }
     }
-    else
+    catch(eprosima::fastcdr::exception::Exception &ex)
     {
         setState(state);
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+template<class _T>
+FastCdr& FastCdr::deserializeQuantized(_T *value_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    float offset = 0, scale = 0;
+    state state(*this);
+
+    try
+    {
+        deserialize(offset);
+        deserialize(scale);
+
+        for(size_t count = 0; count < numElements; count += CODEC_BLOCK)
+        {
+            size_t blockSize = numElements - count < CODEC_BLOCK ? numElements - count : CODEC_BLOCK;
+
+            if(quantization == QuantizationCodec::QUANTIZATION_8_BITS)
+            {
+                uint8_t block[CODEC_BLOCK];
+                deserializeArray(block, blockSize);
+                QuantizationCodec::dequantize(block, blockSize, offset, scale, value_t + count);
+            }
+            else
+            {
+                uint16_t block[CODEC_BLOCK];
+                deserializeArray(block, blockSize);
+                QuantizationCodec::dequantize(block, blockSize, offset, scale, value_t + count);
+            }
+        }
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+FastCdr& FastCdr::serializeHalfArray(const float *float_t, size_t numElements)
+{
+    return serializeHalf(float_t, numElements);
+}
+
+FastCdr& FastCdr::serializeHalfArray(const double *double_t, size_t numElements)
+{
+    return serializeHalf(double_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeHalfArray(float *float_t, size_t numElements)
+{
+    return deserializeHalf(float_t, numElements);
+}
+
+FastCdr& FastCdr::deserializeHalfArray(double *double_t, size_t numElements)
+{
+    return deserializeHalf(double_t, numElements);
+}
+
+FastCdr& FastCdr::serializeQuantizedArray(const float *float_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return serializeQuantized(float_t, numElements, quantization);
+}
+
+FastCdr& FastCdr::serializeQuantizedArray(const double *double_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return serializeQuantized(double_t, numElements, quantization);
+}
+
+FastCdr& FastCdr::deserializeQuantizedArray(float *float_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return deserializeQuantized(float_t, numElements, quantization);
+}
+
+FastCdr& FastCdr::deserializeQuantizedArray(double *double_t, size_t numElements, QuantizationCodec::Quantization quantization)
+{
+    return deserializeQuantized(double_t, numElements, quantization);
+}
+
+FastCdr& FastCdr::serializeDictionaryString(const char *string_t, StringDictionary &dictionary)
+{
+    // A null string shares the entry of the empty string.
+    const char *key = string_t != nullptr ? string_t : "";
+    size_t length = strlen(key);
+    uint32_t reference = dictionary.find(key, length);
+
+    if(reference != 0)
+        return serialize(reference);
+
+    state state(*this);
+
+    try
+    {
+        serialize(reference);
+        serialize(string_t);
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
+    }
+
+    // Added only once the string is in the buffer, so the dictionary does not get ahead of the stream.
+    dictionary.add(key, length);
+
+    return *this;
+}
+
+FastCdr& FastCdr::deserializeDictionaryString(StringDictionary::View &view_t, StringDictionary &dictionary)
+{
+    uint32_t reference = 0;
+    state state(*this);
+
+    try
+    {
+        deserialize(reference);
+
+        if(reference == 0)
+        {
+            uint32_t length = 0;
+            const char *str = readString(length);
+            dictionary.addView(str, length);
+            view_t = StringDictionary::View(str, length);
+        }
+        else
+            view_t = dictionary.getView(reference);
+    }
+    catch(eprosima::fastcdr::exception::Exception &ex)
+    {
+        setState(state);
+        ex.raise();
     }
 
     return *this;
@@ -554,3 +1185,125 @@ FastCdr& FastCdr::deserializeStringSequence(std::string *&sequence_t, size_t &nu
     numElements = seqLength;
     return *this;
 }
+
+FastCdr& FastCdr::serializeVarUInt(uint64_t value)
+{
+    return serializeVarintArray(&value, 1);
+}
+
+FastCdr& FastCdr::serializeVarInt(int64_t value)
+{
+    return serializeVarintArray(&value, 1);
+}
+
+FastCdr& FastCdr::serializeVarintArray(const uint32_t *ulong_t, size_t numElements)
+{
+    size_t totalSize = 0;
+
+    for(size_t count = 0; count < numElements; ++count)
+        totalSize += varintSize(toVarint(ulong_t[count]));
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        char *destination = &m_currentPosition;
+
+        for(size_t count = 0; count < numElements; ++count)
+            destination += encodeVarint(destination, toVarint(ulong_t[count]));
+
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::serializeVarintArray(const int32_t *long_t, size_t numElements)
+{
+    size_t totalSize = 0;
+
+    for(size_t count = 0; count < numElements; ++count)
+        totalSize += varintSize(toVarint(long_t[count]));
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        char *destination = &m_currentPosition;
+
+        for(size_t count = 0; count < numElements; ++count)
+            destination += encodeVarint(destination, toVarint(long_t[count]));
+
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::serializeVarintArray(const uint64_t *ulonglong_t, size_t numElements)
+{
+    size_t totalSize = 0;
+
+    for(size_t count = 0; count < numElements; ++count)
+        totalSize += varintSize(toVarint(ulonglong_t[count]));
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        char *destination = &m_currentPosition;
+
+        for(size_t count = 0; count < numElements; ++count)
+            destination += encodeVarint(destination, toVarint(ulonglong_t[count]));
+
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::serializeVarintArray(const int64_t *longlong_t, size_t numElements)
+{
+    size_t totalSize = 0;
+
+    for(size_t count = 0; count < numElements; ++count)
+        totalSize += varintSize(toVarint(longlong_t[count]));
+
+    if(((m_lastPosition - m_currentPosition) >= totalSize) || resize(totalSize))
+    {
+        char *destination = &m_currentPosition;
+
+        for(size_t count = 0; count < numElements; ++count)
+            destination += encodeVarint(destination, toVarint(longlong_t[count]));
+
+        m_currentPosition += totalSize;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+FastCdr& FastCdr::deserializeVarintArray(uint32_t *ulong_t, size_t numElements)
+{
+    m_currentPosition += decodeVarints(&m_currentPosition, m_lastPosition - m_currentPosition, ulong_t, numElements);
+    return *this;
+}
+
+FastCdr& FastCdr::deserializeVarintArray(int32_t *long_t, size_t numElements)
+{
+    m_currentPosition += decodeVarints(&m_currentPosition, m_lastPosition - m_currentPosition, long_t, numElements);
+    return *this;
+}
+
+FastCdr& FastCdr::deserializeVarintArray(uint64_t *ulonglong_t, size_t numElements)
+{
+    m_currentPosition += decodeVarints(&m_currentPosition, m_lastPosition - m_currentPosition, ulonglong_t, numElements);
+    return *this;
+}
+
+FastCdr& FastCdr::deserializeVarintArray(int64_t *longlong_t, size_t numElements)
+{
+    m_currentPosition += decodeVarints(&m_currentPosition, m_lastPosition - m_currentPosition, longlong_t, numElements);
+    return *this;
+}
@@ -0,0 +1,150 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/MagicRingBuffer.h>
+
+#if !defined(_WIN32)
+
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdio.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+namespace
+{
+    // Returns an unlinked file descriptor backed by memory.
+    int anonymousFile()
+    {
+        int fd = -1;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+        fd = (int)syscall(SYS_memfd_create, "fastcdr_ring", 1U /* MFD_CLOEXEC */);
+
+        if(fd != -1)
+            return fd;
+#endif
+
+        char name[64];
+        snprintf(name, sizeof(name), "/fastcdr_ring_%ld_%p", (long)getpid(), (void*)&name);
+        fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+        if(fd != -1)
+            shm_unlink(name);
+
+        return fd;
+    }
+}
+
+MagicRingBuffer::MagicRingBuffer(size_t capacity) : m_buffer(NULL), m_capacity(0), m_writeIndex(0), m_readIndex(0)
+{
+    if(capacity == 0)
+        throw BadParamException("Invalid capacity in MagicRingBuffer::MagicRingBuffer");
+
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    m_capacity = (capacity + pageSize - 1) / pageSize * pageSize;
+
+    int fd = anonymousFile();
+
+    if(fd == -1)
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    if(ftruncate(fd, (off_t)m_capacity) != 0)
+    {
+        close(fd);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    // Reserve the whole address range first so both mappings are placed consecutively.
+    void *base = mmap(NULL, 2 * m_capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if(base != MAP_FAILED)
+    {
+        char *first = reinterpret_cast<char*>(base);
+
+        if(mmap(first, m_capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == first &&
+                mmap(first + m_capacity, m_capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == first + m_capacity)
+        {
+            m_buffer = first;
+        }
+        else
+        {
+            munmap(base, 2 * m_capacity);
+        }
+    }
+
+    close(fd);
+
+    if(m_buffer == NULL)
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+MagicRingBuffer::~MagicRingBuffer()
+{
+    if(m_buffer != NULL)
+        munmap(m_buffer, 2 * m_capacity);
+}
+
+FastBuffer MagicRingBuffer::reserve(size_t size)
+{
+    if(size > getFreeSize())
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    uint64_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    return FastBuffer(m_buffer + (size_t)(writeIndex % m_capacity), size);
+}
+
+void MagicRingBuffer::commit(size_t length)
+{
+    if(length > getFreeSize())
+        throw BadParamException("Committed length exceeds the free space in MagicRingBuffer::commit");
+
+    m_writeIndex.store(m_writeIndex.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+FastBuffer MagicRingBuffer::peek()
+{
+    uint64_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+    size_t readable = (size_t)(m_writeIndex.load(std::memory_order_acquire) - readIndex);
+    return FastBuffer(m_buffer + (size_t)(readIndex % m_capacity), readable);
+}
+
+void MagicRingBuffer::consume(size_t length)
+{
+    if(length > getReadableSize())
+        throw BadParamException("Consumed length exceeds the readable bytes in MagicRingBuffer::consume");
+
+    m_readIndex.store(m_readIndex.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+size_t MagicRingBuffer::getReadableSize() const
+{
+    return (size_t)(m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_acquire));
+}
+
+size_t MagicRingBuffer::getFreeSize() const
+{
+    return m_capacity - getReadableSize();
+}
+
+#endif // !_WIN32
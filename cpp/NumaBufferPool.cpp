@@ -0,0 +1,295 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/NumaBufferPool.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#if !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+namespace
+{
+#if defined(__linux__)
+    // Values of <numaif.h>, not included to avoid depending on libnuma.
+    const int MPOL_BIND_MODE = 2;
+    const unsigned long MPOL_F_NODE_FLAG = 1UL << 0;
+    const unsigned long MPOL_F_ADDR_FLAG = 1UL << 1;
+
+    const unsigned MAX_NODES = 1024;
+    const unsigned long BITS_PER_LONG = sizeof(unsigned long) * 8;
+
+    unsigned readNumNodes()
+    {
+        FILE *file = fopen("/sys/devices/system/node/online", "r");
+
+        if(file == NULL)
+            return 1;
+
+        // The format is a list of ranges, like "0" or "0-1,3".
+        unsigned numNodes = 1;
+        unsigned first = 0, last = 0;
+        char separator = 0;
+        int read = 0;
+
+        while((read = fscanf(file, "%u%c", &first, &separator)) >= 1)
+        {
+            last = first;
+
+            if(read == 2 && separator == '-')
+            {
+                if(fscanf(file, "%u%c", &last, &separator) < 1)
+                    break;
+            }
+
+            if(last + 1 > numNodes)
+                numNodes = last + 1;
+
+            if(read < 2 || separator != ',')
+                break;
+        }
+
+        fclose(file);
+        return numNodes < MAX_NODES ? numNodes : MAX_NODES;
+    }
+#endif
+
+    size_t pageSize()
+    {
+#if defined(__linux__)
+        static const size_t size = (size_t)sysconf(_SC_PAGESIZE);
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+    // Length of the mapping of a block, in whole pages.
+    size_t mappedLength(size_t blockSize)
+    {
+        return (blockSize + pageSize() - 1) / pageSize() * pageSize();
+    }
+
+    char* mapBlock(size_t length)
+    {
+#if defined(_WIN32)
+        return (char*)malloc(length);
+#else
+        void *memory = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return memory != MAP_FAILED ? (char*)memory : NULL;
+#endif
+    }
+
+    void unmapBlock(char *block, size_t length)
+    {
+#if defined(_WIN32)
+        (void)length;
+        free(block);
+#else
+        munmap(block, length);
+#endif
+    }
+}
+
+NumaBufferPool::NumaBufferPool(size_t blockSize, size_t maxBlocksPerNode) : m_blockSize(blockSize),
+    m_maxBlocksPerNode(maxBlocksPerNode), m_nodes(getNumNodes()), m_allocations(0), m_reuses(0),
+    m_localHandoffs(0), m_remoteHandoffs(0)
+{
+    if(blockSize == 0)
+        throw BadParamException("Invalid block size in NumaBufferPool::NumaBufferPool");
+}
+
+NumaBufferPool::~NumaBufferPool()
+{
+    for(std::unordered_set<char*>::iterator it = m_blocks.begin(); it != m_blocks.end(); ++it)
+        unmapBlock(*it, mappedLength(m_blockSize));
+}
+
+unsigned NumaBufferPool::getNumNodes()
+{
+#if defined(__linux__)
+    static const unsigned numNodes = readNumNodes();
+    return numNodes;
+#else
+    return 1;
+#endif
+}
+
+unsigned NumaBufferPool::getCurrentNode()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    if(getNumNodes() > 1)
+    {
+        unsigned cpu = 0, node = 0;
+
+        if(syscall(SYS_getcpu, &cpu, &node, NULL) == 0 && node < getNumNodes())
+            return node;
+    }
+#endif
+
+    return 0;
+}
+
+unsigned NumaBufferPool::getNodeOfAddress(const void *address)
+{
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+    if(getNumNodes() > 1)
+    {
+        int node = 0;
+
+        if(syscall(SYS_get_mempolicy, &node, NULL, 0UL, address, MPOL_F_NODE_FLAG | MPOL_F_ADDR_FLAG) == 0 &&
+                node >= 0 && (unsigned)node < getNumNodes())
+            return (unsigned)node;
+    }
+#else
+    (void)address;
+#endif
+
+    return 0;
+}
+
+void NumaBufferPool::acquire(FastBuffer &buffer, unsigned node)
+{
+    if(node >= m_nodes.size())
+        node = 0;
+
+    // A block already lent to the buffer would be lost from the free lists otherwise.
+    release(buffer);
+
+    char *block = NULL;
+
+    {
+        std::lock_guard<std::mutex> lock(m_nodes[node].mutex);
+
+        if(!m_nodes[node].blocks.empty())
+        {
+            block = m_nodes[node].blocks.back();
+            m_nodes[node].blocks.pop_back();
+        }
+    }
+
+    if(block != NULL)
+        m_reuses.fetch_add(1, std::memory_order_relaxed);
+    else
+        block = allocateBlock(node);
+
+    buffer.setBuffer(block, m_blockSize);
+}
+
+void NumaBufferPool::release(FastBuffer &buffer)
+{
+    char *block = buffer.getPacket();
+
+    if(buffer.isInternalBuffer() || block == NULL)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_blocksMutex);
+
+        if(m_blocks.find(block) == m_blocks.end())
+            return;
+    }
+
+    buffer.adopt(NULL, 0);
+    unsigned node = getNodeOfAddress(block);
+
+    if(node == getCurrentNode())
+        m_localHandoffs.fetch_add(1, std::memory_order_relaxed);
+    else
+        m_remoteHandoffs.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(m_nodes[node].mutex);
+
+        if(m_nodes[node].blocks.size() < m_maxBlocksPerNode)
+        {
+            m_nodes[node].blocks.push_back(block);
+            return;
+        }
+    }
+
+    freeBlock(block);
+}
+
+NumaBufferPool::Statistics NumaBufferPool::getStatistics() const
+{
+    Statistics statistics;
+    statistics.allocations = m_allocations.load(std::memory_order_relaxed);
+    statistics.reuses = m_reuses.load(std::memory_order_relaxed);
+    statistics.localHandoffs = m_localHandoffs.load(std::memory_order_relaxed);
+    statistics.remoteHandoffs = m_remoteHandoffs.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+char* NumaBufferPool::allocateBlock(unsigned node)
+{
+    size_t length = mappedLength(m_blockSize);
+    char *block = mapBlock(length);
+
+    if(block == NULL)
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+#if defined(__linux__) && defined(SYS_mbind)
+    // The mapping is not touched yet and no other allocation shares its pages, so binding it is enough to place them.
+    if(m_nodes.size() > 1)
+    {
+        unsigned long nodeMask[MAX_NODES / BITS_PER_LONG] = {0};
+        nodeMask[node / BITS_PER_LONG] = 1UL << (node % BITS_PER_LONG);
+        syscall(SYS_mbind, block, length, MPOL_BIND_MODE, nodeMask, (unsigned long)MAX_NODES + 1, 0U);
+    }
+#endif
+
+    // First touch, so the pages are placed now and not by the thread that serializes.
+    for(size_t offset = 0; offset < m_blockSize; offset += pageSize())
+        block[offset] = 0;
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(m_blocksMutex);
+        m_blocks.insert(block);
+    }
+    catch(...)
+    {
+        unmapBlock(block, length);
+        throw;
+    }
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    return block;
+}
+
+void NumaBufferPool::freeBlock(char *block)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_blocksMutex);
+        m_blocks.erase(block);
+    }
+
+    unmapBlock(block, mappedLength(m_blockSize));
+}
@@ -0,0 +1,95 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/ParameterListIndex.h>
+
+#include <algorithm>
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    // Bits of a parameter identifier that are the identifier itself, without the flags.
+    const uint32_t PID_MASK = 0x3fff;
+
+    bool lessPid(const ParameterListIndex::Entry &entry, uint32_t pid)
+    {
+        return entry.pid < pid;
+    }
+
+    bool lessEntry(const ParameterListIndex::Entry &first, const ParameterListIndex::Entry &second)
+    {
+        return first.pid < second.pid;
+    }
+}
+
+ParameterListIndex::ParameterListIndex()
+{
+}
+
+void ParameterListIndex::build(Cdr &cdr)
+{
+    m_entries.clear();
+
+    uint32_t pid = 0;
+    size_t length = 0;
+
+    for(cdr.deserializeParameterHeader(pid, length); (pid & PID_MASK) != Cdr::PID_SENTINEL; cdr.deserializeParameterHeader(pid, length))
+    {
+        Entry entry;
+        entry.pid = pid;
+        entry.offset = cdr.getSerializedDataLength();
+        entry.length = (uint32_t)length;
+        m_entries.push_back(entry);
+
+        cdr.skipMember(length);
+    }
+
+    // Stable, so repeated parameters keep the order of the list.
+    std::stable_sort(m_entries.begin(), m_entries.end(), lessEntry);
+}
+
+const ParameterListIndex::Entry* ParameterListIndex::find(uint32_t pid) const
+{
+    std::vector<Entry>::const_iterator it = std::lower_bound(m_entries.begin(), m_entries.end(), pid, lessPid);
+
+    if(it == m_entries.end() || it->pid != pid)
+        return NULL;
+
+    return &*it;
+}
+
+size_t ParameterListIndex::count(uint32_t pid) const
+{
+    std::vector<Entry>::const_iterator it = std::lower_bound(m_entries.begin(), m_entries.end(), pid, lessPid);
+    size_t number = 0;
+
+    for(; it != m_entries.end() && it->pid == pid; ++it)
+        ++number;
+
+    return number;
+}
+
+bool ParameterListIndex::seek(Cdr &cdr, uint32_t pid) const
+{
+    const Entry *entry = find(pid);
+
+    if(entry == NULL)
+        return false;
+
+    cdr.reset();
+    cdr.jump(entry->offset);
+    cdr.resetAlignment();
+    return true;
+}
@@ -0,0 +1,293 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/QuantizationCodec.h>
+
+#include <string.h>
+#include <float.h>
+#include <limits>
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    inline uint16_t floatToHalf(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+        uint32_t exponent = (bits >> 23) & 0xff;
+        uint32_t mantissa = bits & 0x7fffff;
+
+        // Infinity or NaN, keeping NaN quiet.
+        if(exponent == 0xff)
+            return (uint16_t)(sign | 0x7c00 | (mantissa != 0 ? 0x200 | (mantissa >> 13) : 0));
+
+        int32_t halfExponent = (int32_t)exponent - 127 + 15;
+
+        if(halfExponent >= 0x1f)
+            return (uint16_t)(sign | 0x7c00);
+
+        if(halfExponent <= 0)
+        {
+            // Subnormal or zero.
+            if(halfExponent < -10)
+                return sign;
+
+            mantissa |= 0x800000;
+            uint32_t shift = (uint32_t)(14 - halfExponent);
+            uint32_t half = mantissa >> shift;
+            uint32_t remainder = mantissa & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+
+            if(remainder > halfway || (remainder == halfway && (half & 1)))
+                ++half;
+
+            return (uint16_t)(sign | half);
+        }
+
+        uint32_t half = ((uint32_t)halfExponent << 10) | (mantissa >> 13);
+        uint32_t remainder = mantissa & 0x1fff;
+
+        // A carry from the mantissa increments the exponent, up to infinity.
+        if(remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+            ++half;
+
+        return (uint16_t)(sign | half);
+    }
+
+    inline float halfToFloat(uint16_t half)
+    {
+        uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+        uint32_t exponent = (half >> 10) & 0x1f;
+        uint32_t mantissa = half & 0x3ff;
+        uint32_t bits;
+
+        // Infinity or NaN, made quiet as F16C does.
+        if(exponent == 0x1f)
+            bits = sign | 0x7f800000 | (mantissa != 0 ? 0x400000 | (mantissa << 13) : 0);
+        else if(exponent != 0)
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        else if(mantissa == 0)
+            bits = sign;
+        else
+        {
+            // Subnormal, normalized for the float.
+            uint32_t shift = 0;
+
+            while((mantissa & 0x400) == 0)
+            {
+                mantissa <<= 1;
+                ++shift;
+            }
+
+            bits = sign | ((113 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+        }
+
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    template<class _T>
+        void computeRange(const _T *value_t, size_t numElements, QuantizationCodec::Quantization quantization,
+                float &offset, float &scale)
+        {
+            const double levels = quantization == QuantizationCodec::QUANTIZATION_8_BITS ? 255.0 : 65535.0;
+            bool found = false;
+            _T minimum = 0, maximum = 0;
+
+            for(size_t count = 0; count < numElements; ++count)
+            {
+                _T value = value_t[count];
+
+                // Skips NaN and infinities.
+                if(!(value - value == 0))
+                    continue;
+
+                if(!found)
+                {
+                    minimum = maximum = value;
+                    found = true;
+                }
+                else if(value < minimum)
+                    minimum = value;
+                else if(value > maximum)
+                    maximum = value;
+            }
+
+            // Doubles beyond the float range are clamped, so the offset and the scale stay finite.
+            double low = (double)minimum < -FLT_MAX ? -FLT_MAX : (double)minimum;
+            double high = (double)maximum > FLT_MAX ? FLT_MAX : (double)maximum;
+
+            offset = (float)low;
+            scale = (float)((high - (double)offset) / levels);
+        }
+
+    template<class _T, class _C>
+        void quantizeArray(const _T *value_t, size_t numElements, float offset, float scale, _C *code_t)
+        {
+            const double levels = (double)(_C)-1;
+            const double inverse = scale != 0 ? 1.0 / (double)scale : 0;
+
+            for(size_t count = 0; count < numElements; ++count)
+            {
+                // Computed in double because the distance to the offset may not fit in a float.
+                double position = ((double)value_t[count] - (double)offset) * inverse;
+
+                // NaN fails both comparisons and becomes the code 0.
+                if(!(position > 0))
+                    position = 0;
+                else if(position > levels)
+                    position = levels;
+
+                code_t[count] = (_C)(position + 0.5);
+            }
+        }
+
+    template<class _C, class _T>
+        void dequantizeArray(const _C *code_t, size_t numElements, float offset, float scale, _T *value_t)
+        {
+            const double maximum = (double)std::numeric_limits<_T>::max();
+
+            for(size_t count = 0; count < numElements; ++count)
+            {
+                // Computed in double and clamped, so the rounding of the scale does not overflow to infinity.
+                double value = (double)offset + (double)code_t[count] * (double)scale;
+
+                if(value > maximum)
+                    value = maximum;
+                else if(value < -maximum)
+                    value = -maximum;
+
+                value_t[count] = (_T)value;
+            }
+        }
+
+    // Doubles are converted through floats by blocks.
+    const size_t CONVERSION_BLOCK = 256;
+}
+
+void QuantizationCodec::toHalf(const float *float_t, size_t numElements, uint16_t *half_t)
+{
+    size_t count = 0;
+
+#if defined(__F16C__)
+    for(; count + 8 <= numElements; count += 8)
+    {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(float_t + count), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(half_t + count), half);
+    }
+#endif
+
+    for(; count < numElements; ++count)
+        half_t[count] = floatToHalf(float_t[count]);
+}
+
+void QuantizationCodec::toHalf(const double *double_t, size_t numElements, uint16_t *half_t)
+{
+    float block[CONVERSION_BLOCK];
+
+    for(size_t count = 0; count < numElements; count += CONVERSION_BLOCK)
+    {
+        size_t blockSize = numElements - count < CONVERSION_BLOCK ? numElements - count : CONVERSION_BLOCK;
+
+        for(size_t index = 0; index < blockSize; ++index)
+            block[index] = (float)double_t[count + index];
+
+        toHalf(block, blockSize, half_t + count);
+    }
+}
+
+void QuantizationCodec::fromHalf(const uint16_t *half_t, size_t numElements, float *float_t)
+{
+    size_t count = 0;
+
+#if defined(__F16C__)
+    for(; count + 8 <= numElements; count += 8)
+        _mm256_storeu_ps(float_t + count, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(half_t + count))));
+#endif
+
+    for(; count < numElements; ++count)
+        float_t[count] = halfToFloat(half_t[count]);
+}
+
+void QuantizationCodec::fromHalf(const uint16_t *half_t, size_t numElements, double *double_t)
+{
+    float block[CONVERSION_BLOCK];
+
+    for(size_t count = 0; count < numElements; count += CONVERSION_BLOCK)
+    {
+        size_t blockSize = numElements - count < CONVERSION_BLOCK ? numElements - count : CONVERSION_BLOCK;
+
+        fromHalf(half_t + count, blockSize, block);
+
+        for(size_t index = 0; index < blockSize; ++index)
+            double_t[count + index] = block[index];
+    }
+}
+
+void QuantizationCodec::getRange(const float *float_t, size_t numElements, Quantization quantization, float &offset, float &scale)
+{
+    computeRange(float_t, numElements, quantization, offset, scale);
+}
+
+void QuantizationCodec::getRange(const double *double_t, size_t numElements, Quantization quantization, float &offset, float &scale)
+{
+    computeRange(double_t, numElements, quantization, offset, scale);
+}
+
+void QuantizationCodec::quantize(const float *float_t, size_t numElements, float offset, float scale, uint8_t *code_t)
+{
+    quantizeArray(float_t, numElements, offset, scale, code_t);
+}
+
+void QuantizationCodec::quantize(const float *float_t, size_t numElements, float offset, float scale, uint16_t *code_t)
+{
+    quantizeArray(float_t, numElements, offset, scale, code_t);
+}
+
+void QuantizationCodec::quantize(const double *double_t, size_t numElements, float offset, float scale, uint8_t *code_t)
+{
+    quantizeArray(double_t, numElements, offset, scale, code_t);
+}
+
+void QuantizationCodec::quantize(const double *double_t, size_t numElements, float offset, float scale, uint16_t *code_t)
+{
+    quantizeArray(double_t, numElements, offset, scale, code_t);
+}
+
+void QuantizationCodec::dequantize(const uint8_t *code_t, size_t numElements, float offset, float scale, float *float_t)
+{
+    dequantizeArray(code_t, numElements, offset, scale, float_t);
+}
+
+void QuantizationCodec::dequantize(const uint16_t *code_t, size_t numElements, float offset, float scale, float *float_t)
+{
+    dequantizeArray(code_t, numElements, offset, scale, float_t);
+}
+
+void QuantizationCodec::dequantize(const uint8_t *code_t, size_t numElements, float offset, float scale, double *double_t)
+{
+    dequantizeArray(code_t, numElements, offset, scale, double_t);
+}
+
+void QuantizationCodec::dequantize(const uint16_t *code_t, size_t numElements, float offset, float scale, double *double_t)
+{
+    dequantizeArray(code_t, numElements, offset, scale, double_t);
+}
@@ -0,0 +1,211 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/SharedBuffer.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+#include <atomic>
+#include <string.h>
+
+#if !__APPLE__
+#include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        struct SharedBufferBlock
+        {
+            SharedBufferBlock(char *data, size_t length, size_t capacity) : refs(1), data(data), length(length),
+                capacity(capacity), view(data, length), readView(data, length)
+            {
+            }
+
+            ~SharedBufferBlock()
+            {
+                free(data);
+            }
+
+            std::atomic<uint32_t> refs;
+            char *data;
+            size_t length;
+            size_t capacity;
+
+            // Covers data[0, length) while the block is readable and data[0, capacity) while it is written.
+            FastBuffer view;
+
+            // Always covers data[0, length). It is the view handed to the readers.
+            ConstFastBuffer readView;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+namespace
+{
+    SharedBufferBlock* allocateBlock(const char *data, size_t length, size_t capacity)
+    {
+        char *memory = (char*)malloc(capacity > 0 ? capacity : 1);
+
+        if(memory == NULL)
+            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+        if(length > 0)
+            memcpy(memory, data, length);
+
+        return new SharedBufferBlock(memory, length, capacity);
+    }
+
+    void releaseBlock(SharedBufferBlock *block)
+    {
+        if(block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete block;
+    }
+}
+
+SharedBuffer::SharedBuffer(size_t capacity) : m_block(allocateBlock(NULL, 0, capacity))
+{
+}
+
+SharedBuffer::SharedBuffer(const char *data, size_t length) : m_block(allocateBlock(data, length, length))
+{
+}
+
+SharedBuffer::SharedBuffer(FastBuffer &buffer, size_t length) : m_block(NULL)
+{
+    if(length > buffer.getBufferSize())
+        throw BadParamException("Length exceeds the buffer size in SharedBuffer::SharedBuffer");
+
+    if(!buffer.isInternalBuffer() || buffer.getPacket() == NULL || buffer.getHeadroom() != 0)
+    {
+        m_block = allocateBlock(buffer.getBuffer(), length, length);
+        return;
+    }
+
+    size_t capacity = buffer.getBufferSize();
+    char *memory = buffer.release();
+
+    try
+    {
+        m_block = new SharedBufferBlock(memory, length, capacity);
+    }
+    catch(...)
+    {
+        buffer.adopt(memory, capacity);
+        throw;
+    }
+}
+
+SharedBuffer::SharedBuffer(const SharedBuffer &buffer) : m_block(buffer.m_block)
+{
+    m_block->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+SharedBuffer& SharedBuffer::operator=(const SharedBuffer &buffer)
+{
+    if(m_block != buffer.m_block)
+    {
+        buffer.m_block->refs.fetch_add(1, std::memory_order_relaxed);
+        releaseBlock(m_block);
+        m_block = buffer.m_block;
+    }
+
+    return *this;
+}
+
+SharedBuffer::~SharedBuffer()
+{
+    releaseBlock(m_block);
+}
+
+const ConstFastBuffer& SharedBuffer::getBuffer() const
+{
+    return m_block->readView;
+}
+
+FastBuffer& SharedBuffer::getWritableBuffer()
+{
+    detach(m_block->capacity);
+    m_block->view.setBuffer(m_block->data, m_block->capacity);
+    return m_block->view;
+}
+
+void SharedBuffer::setLength(size_t length)
+{
+    if(length > m_block->capacity)
+        throw BadParamException("Length exceeds the capacity in SharedBuffer::setLength");
+
+    detach(m_block->capacity);
+    m_block->length = length;
+    m_block->view.setBuffer(m_block->data, length);
+    m_block->readView.setBuffer(m_block->data, length);
+}
+
+void SharedBuffer::reserve(size_t capacity)
+{
+    if(capacity > m_block->capacity)
+        detach(capacity);
+}
+
+const char* SharedBuffer::getData() const
+{
+    return m_block->data;
+}
+
+size_t SharedBuffer::getLength() const
+{
+    return m_block->length;
+}
+
+size_t SharedBuffer::getCapacity() const
+{
+    return m_block->capacity;
+}
+
+uint32_t SharedBuffer::getUseCount() const
+{
+    return m_block->refs.load(std::memory_order_relaxed);
+}
+
+void SharedBuffer::detach(size_t capacity)
+{
+    if(m_block->refs.load(std::memory_order_acquire) == 1)
+    {
+        if(capacity > m_block->capacity)
+        {
+            char *memory = (char*)realloc(m_block->data, capacity);
+
+            if(memory == NULL)
+                throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+            m_block->data = memory;
+            m_block->capacity = capacity;
+            m_block->view.setBuffer(memory, m_block->length);
+            m_block->readView.setBuffer(memory, m_block->length);
+        }
+
+        return;
+    }
+
+    SharedBufferBlock *block = allocateBlock(m_block->data, m_block->length,
+            capacity > m_block->capacity ? capacity : m_block->capacity);
+    releaseBlock(m_block);
+    m_block = block;
+}
@@ -0,0 +1,399 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/ShmRing.h>
+
+#if !defined(_WIN32)
+
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <climits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+#define SHMRING_MAGIC 0x52534346
+#define SHMRING_CACHE_LINE 64
+#define SHMRING_SPIN_COUNT 512
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        struct ShmRingControl
+        {
+            std::atomic<uint32_t> magic;
+            uint32_t slotCount;
+            uint32_t mode;
+            uint64_t slotSize;
+            uint64_t slotStride;
+
+            // Producer index.
+            alignas(SHMRING_CACHE_LINE) std::atomic<uint64_t> head;
+
+            // Consumer index.
+            alignas(SHMRING_CACHE_LINE) std::atomic<uint64_t> tail;
+
+            // Futex signalled when a frame is committed.
+            alignas(SHMRING_CACHE_LINE) std::atomic<uint32_t> dataSignal;
+            std::atomic<uint32_t> dataWaiters;
+
+            // Futex signalled when a slot is released.
+            alignas(SHMRING_CACHE_LINE) std::atomic<uint32_t> spaceSignal;
+            std::atomic<uint32_t> spaceWaiters;
+        };
+
+        struct ShmRingSlot
+        {
+            std::atomic<uint64_t> sequence;
+            uint64_t length;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    inline size_t roundUp(size_t value, size_t multiple)
+    {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    inline size_t controlSize()
+    {
+        return roundUp(sizeof(ShmRingControl), SHMRING_CACHE_LINE);
+    }
+
+    void futexWait(std::atomic<uint32_t> *word, uint32_t expected, int32_t timeoutMs)
+    {
+#if defined(__linux__)
+        struct timespec ts;
+        struct timespec *pts = NULL;
+
+        if(timeoutMs >= 0)
+        {
+            ts.tv_sec = timeoutMs / 1000;
+            ts.tv_nsec = (timeoutMs % 1000) * 1000000L;
+            pts = &ts;
+        }
+
+        // Not FUTEX_PRIVATE: the word lives in memory shared between processes.
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, pts, NULL, 0);
+#else
+        if(word->load() == expected)
+            usleep(timeoutMs >= 0 && timeoutMs < 1 ? 100 : 1000);
+#endif
+    }
+
+    void futexWake(std::atomic<uint32_t> *word)
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#else
+        (void)word;
+#endif
+    }
+
+    void signal(std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiters)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        word.fetch_add(1, std::memory_order_seq_cst);
+
+        if(waiters.load(std::memory_order_seq_cst) != 0)
+            futexWake(&word);
+    }
+
+    /*
+     * Spins for a while calling tryOnce, then sleeps on the futex word until it succeeds or the timeout expires.
+     * The waiter is registered before the last check so a concurrent signal() cannot be lost.
+     */
+    template<class _F>
+        bool waitFor(_F tryOnce, std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiters, int32_t timeoutMs)
+        {
+            for(int spin = 0; spin < SHMRING_SPIN_COUNT; ++spin)
+            {
+                if(tryOnce())
+                    return true;
+            }
+
+            const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMs >= 0 ? timeoutMs : 0);
+
+            for(;;)
+            {
+                waiters.fetch_add(1, std::memory_order_seq_cst);
+                uint32_t observed = word.load(std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if(tryOnce())
+                {
+                    waiters.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                int32_t wait = -1;
+
+                if(timeoutMs >= 0)
+                {
+                    Clock::time_point now = Clock::now();
+
+                    if(now >= deadline)
+                    {
+                        waiters.fetch_sub(1, std::memory_order_relaxed);
+                        return false;
+                    }
+
+                    wait = (int32_t)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1;
+                }
+
+                futexWait(&word, observed, wait);
+                waiters.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+}
+
+ShmRing::ShmRing(const char *name, uint32_t slotCount, size_t slotSize, ProducerMode mode) : m_name(name != NULL ? name : ""),
+    m_control(NULL), m_mappedSize(0)
+{
+    if(name == NULL || slotCount == 0 || (slotCount & (slotCount - 1)) != 0 || slotSize == 0)
+        throw BadParamException("Invalid parameters in ShmRing::ShmRing, slotCount has to be a power of two");
+
+    size_t slotStride = SHMRING_CACHE_LINE + roundUp(slotSize, SHMRING_CACHE_LINE);
+    m_mappedSize = controlSize() + slotStride * slotCount;
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0660);
+
+    if(fd == -1)
+        throw BadParamException("Cannot create the shared memory object in ShmRing::ShmRing");
+
+    if(ftruncate(fd, (off_t)m_mappedSize) != 0)
+    {
+        close(fd);
+        shm_unlink(name);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    void *address = mmap(NULL, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(address == MAP_FAILED)
+    {
+        shm_unlink(name);
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+
+    m_control = new(address) ShmRingControl();
+    m_control->slotCount = slotCount;
+    m_control->mode = (uint32_t)mode;
+    m_control->slotSize = slotSize;
+    m_control->slotStride = slotStride;
+    m_control->head.store(0, std::memory_order_relaxed);
+    m_control->tail.store(0, std::memory_order_relaxed);
+    m_control->dataSignal.store(0, std::memory_order_relaxed);
+    m_control->dataWaiters.store(0, std::memory_order_relaxed);
+    m_control->spaceSignal.store(0, std::memory_order_relaxed);
+    m_control->spaceWaiters.store(0, std::memory_order_relaxed);
+
+    for(uint32_t count = 0; count < slotCount; ++count)
+    {
+        ShmRingSlot *slot = new(slotAt(count)) ShmRingSlot();
+        slot->sequence.store(count, std::memory_order_relaxed);
+        slot->length = 0;
+    }
+
+    // Publish the initialized segment to the processes that open it.
+    m_control->magic.store(SHMRING_MAGIC, std::memory_order_release);
+}
+
+ShmRing::ShmRing(const char *name) : m_name(name != NULL ? name : ""), m_control(NULL), m_mappedSize(0)
+{
+    if(name == NULL)
+        throw BadParamException("Invalid name in ShmRing::ShmRing");
+
+    int fd = shm_open(name, O_RDWR, 0);
+
+    if(fd == -1)
+        throw BadParamException("Cannot open the shared memory object in ShmRing::ShmRing");
+
+    struct stat info;
+
+    if(fstat(fd, &info) != 0 || (size_t)info.st_size < controlSize())
+    {
+        close(fd);
+        throw BadParamException("The shared memory object is not a ShmRing in ShmRing::ShmRing");
+    }
+
+    m_mappedSize = (size_t)info.st_size;
+    void *address = mmap(NULL, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(address == MAP_FAILED)
+        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+    m_control = reinterpret_cast<ShmRingControl*>(address);
+
+    if(m_control->magic.load(std::memory_order_acquire) != SHMRING_MAGIC ||
+            controlSize() + m_control->slotStride * m_control->slotCount != m_mappedSize)
+    {
+        munmap(address, m_mappedSize);
+        m_control = NULL;
+        throw BadParamException("The shared memory object is not a ShmRing in ShmRing::ShmRing");
+    }
+}
+
+ShmRing::~ShmRing()
+{
+    if(m_control != NULL)
+        munmap(m_control, m_mappedSize);
+}
+
+bool ShmRing::unlink(const char *name)
+{
+    return shm_unlink(name) == 0;
+}
+
+char* ShmRing::slotAt(uint64_t ticket) const
+{
+    return reinterpret_cast<char*>(m_control) + controlSize() +
+        (size_t)(ticket & (m_control->slotCount - 1)) * m_control->slotStride;
+}
+
+bool ShmRing::acquire(Frame &frame, int32_t timeoutMs)
+{
+    ShmRingControl &control = *m_control;
+    uint64_t ticket = 0;
+
+    bool acquired = waitFor([&]() -> bool
+            {
+                uint64_t position = control.head.load(std::memory_order_relaxed);
+
+                for(;;)
+                {
+                    ShmRingSlot *slot = reinterpret_cast<ShmRingSlot*>(slotAt(position));
+                    int64_t diff = (int64_t)(slot->sequence.load(std::memory_order_acquire) - position);
+
+                    if(diff == 0)
+                    {
+                        if(control.mode == SINGLE_PRODUCER)
+                        {
+                            control.head.store(position + 1, std::memory_order_relaxed);
+                            ticket = position;
+                            return true;
+                        }
+                        else if(control.head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            ticket = position;
+                            return true;
+                        }
+                    }
+                    else if(diff < 0)
+                    {
+                        // The ring is full.
+                        return false;
+                    }
+                    else
+                    {
+                        position = control.head.load(std::memory_order_relaxed);
+                    }
+                }
+            }, control.spaceSignal, control.spaceWaiters, timeoutMs);
+
+    if(acquired)
+    {
+        frame.m_data = slotAt(ticket) + SHMRING_CACHE_LINE;
+        frame.m_size = (size_t)control.slotSize;
+        frame.m_ticket = ticket;
+    }
+
+    return acquired;
+}
+
+void ShmRing::commit(Frame &frame, size_t length)
+{
+    if(length > m_control->slotSize)
+        throw BadParamException("Frame length exceeds the slot size in ShmRing::commit");
+
+    ShmRingSlot *slot = reinterpret_cast<ShmRingSlot*>(slotAt(frame.m_ticket));
+    slot->length = length;
+    slot->sequence.store(frame.m_ticket + 1, std::memory_order_release);
+
+    signal(m_control->dataSignal, m_control->dataWaiters);
+}
+
+bool ShmRing::receive(Frame &frame, int32_t timeoutMs)
+{
+    ShmRingControl &control = *m_control;
+    uint64_t ticket = 0;
+
+    bool received = waitFor([&]() -> bool
+            {
+                uint64_t position = control.tail.load(std::memory_order_relaxed);
+                ShmRingSlot *slot = reinterpret_cast<ShmRingSlot*>(slotAt(position));
+
+                if(slot->sequence.load(std::memory_order_acquire) == position + 1)
+                {
+                    control.tail.store(position + 1, std::memory_order_relaxed);
+                    ticket = position;
+                    return true;
+                }
+
+                return false;
+            }, control.dataSignal, control.dataWaiters, timeoutMs);
+
+    if(received)
+    {
+        frame.m_data = slotAt(ticket) + SHMRING_CACHE_LINE;
+        frame.m_size = (size_t)reinterpret_cast<ShmRingSlot*>(slotAt(ticket))->length;
+        frame.m_ticket = ticket;
+    }
+
+    return received;
+}
+
+void ShmRing::release(Frame &frame)
+{
+    ShmRingSlot *slot = reinterpret_cast<ShmRingSlot*>(slotAt(frame.m_ticket));
+    slot->sequence.store(frame.m_ticket + m_control->slotCount, std::memory_order_release);
+    frame.m_data = NULL;
+    frame.m_size = 0;
+
+    signal(m_control->spaceSignal, m_control->spaceWaiters);
+}
+
+uint32_t ShmRing::getSlotCount() const
+{
+    return m_control->slotCount;
+}
+
+size_t ShmRing::getSlotSize() const
+{
+    return (size_t)m_control->slotSize;
+}
+
+#endif // !_WIN32
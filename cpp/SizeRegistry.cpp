@@ -0,0 +1,123 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/SizeRegistry.h>
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    // Sizes below 4 have their own bucket. Bigger sizes use four buckets for each power of two,
+    // selected by the two bits after the most significant one.
+    size_t bucketIndex(size_t size)
+    {
+        if(size < 4)
+            return size;
+
+        size_t exponent = 0;
+
+        while((size >> exponent) > 1)
+            ++exponent;
+
+        return exponent * 4 + ((size >> (exponent - 2)) & 3);
+    }
+
+    size_t bucketUpperBound(size_t index)
+    {
+        if(index < 4)
+            return index;
+
+        size_t exponent = index / 4;
+        size_t upper = (4 + (index & 3) + 1);
+
+        // The last bucket of the biggest power of two would overflow.
+        if(exponent - 2 >= sizeof(size_t) * 8 - 3)
+            return (size_t)-1;
+
+        return (upper << (exponent - 2)) - 1;
+    }
+}
+
+SizeRegistry::Entry::Entry() : m_count(0), m_maxSize(0)
+{
+    for(size_t index = 0; index < NUM_BUCKETS; ++index)
+        m_buckets[index].store(0, std::memory_order_relaxed);
+}
+
+void SizeRegistry::Entry::record(size_t size)
+{
+    m_buckets[bucketIndex(size)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    size_t maxSize = m_maxSize.load(std::memory_order_relaxed);
+
+    while(size > maxSize && !m_maxSize.compare_exchange_weak(maxSize, size, std::memory_order_relaxed));
+}
+
+size_t SizeRegistry::Entry::getPercentile(double percentile) const
+{
+    uint64_t count = getCount();
+
+    if(count == 0)
+        return 0;
+
+    if(percentile >= 1.0)
+        return getMaxSize();
+
+    uint64_t rank = (uint64_t)(percentile * (double)count);
+    uint64_t accumulated = 0;
+    size_t maxSize = getMaxSize();
+
+    for(size_t index = 0; index < NUM_BUCKETS; ++index)
+    {
+        accumulated += m_buckets[index].load(std::memory_order_relaxed);
+
+        if(accumulated > rank)
+        {
+            size_t upper = bucketUpperBound(index);
+            return upper < maxSize ? upper : maxSize;
+        }
+    }
+
+    return maxSize;
+}
+
+SizeRegistry::SizeRegistry(double percentile, double margin, size_t defaultSize) : m_percentile(percentile),
+    m_margin(margin), m_defaultSize(defaultSize)
+{
+}
+
+SizeRegistry::~SizeRegistry()
+{
+}
+
+SizeRegistry::Entry& SizeRegistry::getEntry(const std::string &tag)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<Entry> &entry = m_entries[tag];
+
+    if(!entry)
+        entry.reset(new Entry());
+
+    return *entry;
+}
+
+size_t SizeRegistry::getRecommendedSize(const Entry &entry) const
+{
+    if(entry.getCount() == 0)
+        return m_defaultSize;
+
+    size_t size = entry.getPercentile(m_percentile);
+    return size + (size_t)((double)size * m_margin);
+}
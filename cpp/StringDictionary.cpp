@@ -0,0 +1,149 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/StringDictionary.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+#include <string.h>
+
+using namespace eprosima::fastcdr;
+using namespace ::exception;
+
+namespace
+{
+    const size_t INITIAL_TABLE_SIZE = 64;
+
+    // Hashes the string a word at a time.
+    uint32_t hashString(const char *string_t, size_t length)
+    {
+        uint64_t hash = 0x9e3779b97f4a7c15ull ^ length;
+
+        for(; length >= sizeof(uint64_t); length -= sizeof(uint64_t), string_t += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, string_t, sizeof(word));
+            hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+            hash ^= hash >> 32;
+        }
+
+        if(length > 0)
+        {
+            uint64_t word = 0;
+            memcpy(&word, string_t, length);
+            hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+        }
+
+        hash ^= hash >> 29;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        return (uint32_t)(hash >> 32);
+    }
+}
+
+StringDictionary::StringDictionary()
+{
+}
+
+void StringDictionary::clear()
+{
+    m_views.clear();
+    m_offsets.clear();
+    m_hashes.clear();
+    m_characters.clear();
+
+    if(!m_table.empty())
+        memset(&m_table[0], 0, m_table.size() * sizeof(uint32_t));
+}
+
+uint32_t StringDictionary::find(const char *string_t, size_t length) const
+{
+    if(m_table.empty())
+        return 0;
+
+    uint32_t hash = hashString(string_t, length);
+    size_t mask = m_table.size() - 1;
+
+    for(size_t slot = hash & mask; m_table[slot] != 0; slot = (slot + 1) & mask)
+    {
+        uint32_t reference = m_table[slot];
+        const View &view = m_views[reference - 1];
+
+        if(m_hashes[reference - 1] == hash && view.length == length && memcmp(view.data, string_t, length) == 0)
+            return reference;
+    }
+
+    return 0;
+}
+
+uint32_t StringDictionary::add(const char *string_t, size_t length)
+{
+    // The table is kept at most half full.
+    if((m_views.size() + 1) * 2 > m_table.size())
+    {
+        m_table.assign(m_table.empty() ? INITIAL_TABLE_SIZE : m_table.size() * 2, 0);
+        size_t mask = m_table.size() - 1;
+
+        for(size_t index = 0; index < m_hashes.size(); ++index)
+        {
+            size_t slot = m_hashes[index] & mask;
+
+            while(m_table[slot] != 0)
+                slot = (slot + 1) & mask;
+
+            m_table[slot] = (uint32_t)(index + 1);
+        }
+    }
+
+    const char *previous = m_characters.empty() ? NULL : &m_characters[0];
+    size_t offset = m_characters.size();
+
+    m_characters.insert(m_characters.end(), string_t, string_t + length);
+    m_characters.push_back('\0');
+
+    // The copies were moved, so the views are updated.
+    if(&m_characters[0] != previous)
+    {
+        for(size_t index = 0; index < m_views.size(); ++index)
+            m_views[index].data = &m_characters[m_offsets[index]];
+    }
+
+    uint32_t hash = hashString(string_t, length);
+    m_views.push_back(View(&m_characters[offset], length));
+    m_offsets.push_back(offset);
+    m_hashes.push_back(hash);
+
+    uint32_t reference = (uint32_t)m_views.size();
+    size_t mask = m_table.size() - 1;
+    size_t slot = hash & mask;
+
+    while(m_table[slot] != 0)
+        slot = (slot + 1) & mask;
+
+    m_table[slot] = reference;
+
+    return reference;
+}
+
+uint32_t StringDictionary::addView(const char *string_t, size_t length)
+{
+    m_views.push_back(View(string_t, length));
+    return (uint32_t)m_views.size();
+}
+
+const StringDictionary::View& StringDictionary::getView(uint32_t reference) const
+{
+    if(reference == 0 || reference > m_views.size())
+        throw BadParamException("Unknown string dictionary reference");
+
+    return m_views[reference - 1];
+}
@@ -0,0 +1,206 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/ThreadPool.h>
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    // Pool whose job is being run by the current thread. Used to run nested jobs inline.
+    thread_local ThreadPool *currentPool = NULL;
+}
+
+namespace
+{
+    size_t resolveNumThreads(size_t numThreads)
+    {
+        if(numThreads == 0)
+            numThreads = std::thread::hardware_concurrency();
+
+        return numThreads == 0 ? 1 : numThreads;
+    }
+}
+
+ThreadPool::ThreadPool(size_t numThreads) : m_generation(0), m_stop(false), m_task(NULL), m_numTasks(0),
+    m_ranges(resolveNumThreads(numThreads)), m_activeWorkers(0), m_failed(false)
+{
+    for(size_t count = 1; count < m_ranges.size(); ++count)
+        m_workers.push_back(std::thread(&ThreadPool::workerLoop, this, count));
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_jobCondition.notify_all();
+
+    for(size_t count = 0; count < m_workers.size(); ++count)
+        m_workers[count].join();
+}
+
+void ThreadPool::parallelFor(size_t numTasks, const std::function<void(size_t)> &task)
+{
+    if(numTasks == 0)
+        return;
+
+    std::unique_lock<std::mutex> submit(m_submitMutex, std::defer_lock);
+
+    if(numTasks == 1 || m_workers.empty() || currentPool == this || !submit.try_lock())
+    {
+        for(size_t index = 0; index < numTasks; ++index)
+            task(index);
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_numTasks = numTasks;
+
+        for(size_t count = 0; count < m_ranges.size(); ++count)
+        {
+            std::lock_guard<std::mutex> rangeLock(m_ranges[count].mutex);
+            m_ranges[count].begin = numTasks * count / m_ranges.size();
+            m_ranges[count].end = numTasks * (count + 1) / m_ranges.size();
+        }
+
+        m_failed.store(false, std::memory_order_relaxed);
+        m_exception = std::exception_ptr();
+        m_activeWorkers = m_workers.size();
+        ++m_generation;
+    }
+
+    m_jobCondition.notify_all();
+
+    ThreadPool *previous = currentPool;
+    currentPool = this;
+    runTasks(0);
+    currentPool = previous;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while(m_activeWorkers != 0)
+            m_doneCondition.wait(lock);
+
+        m_task = NULL;
+    }
+
+    if(m_exception)
+    {
+        std::exception_ptr exception = m_exception;
+        m_exception = std::exception_ptr();
+        std::rethrow_exception(exception);
+    }
+}
+
+void ThreadPool::workerLoop(size_t self)
+{
+    uint64_t generation = 0;
+    currentPool = this;
+
+    for(;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while(!m_stop && m_generation == generation)
+                m_jobCondition.wait(lock);
+
+            if(m_stop)
+                return;
+
+            generation = m_generation;
+        }
+
+        runTasks(self);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(--m_activeWorkers == 0)
+            m_doneCondition.notify_one();
+    }
+}
+
+void ThreadPool::runTasks(size_t self)
+{
+    size_t index = 0;
+
+    while(popTask(self, index) || stealTasks(self, index))
+    {
+        if(m_failed.load(std::memory_order_relaxed))
+            continue;
+
+        try
+        {
+            (*m_task)(index);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(m_exceptionMutex);
+
+            if(!m_exception)
+                m_exception = std::current_exception();
+
+            m_failed.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ThreadPool::popTask(size_t self, size_t &index)
+{
+    TaskRange &range = m_ranges[self];
+    std::lock_guard<std::mutex> lock(range.mutex);
+
+    if(range.begin == range.end)
+        return false;
+
+    index = range.begin++;
+    return true;
+}
+
+bool ThreadPool::stealTasks(size_t self, size_t &index)
+{
+    for(size_t count = 1; count < m_ranges.size(); ++count)
+    {
+        TaskRange &victim = m_ranges[(self + count) % m_ranges.size()];
+        size_t begin = 0, end = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            size_t remaining = victim.end - victim.begin;
+
+            if(remaining == 0)
+                continue;
+
+            end = victim.end;
+            begin = end - (remaining + 1) / 2;
+            victim.end = begin;
+        }
+
+        TaskRange &range = m_ranges[self];
+        std::lock_guard<std::mutex> lock(range.mutex);
+        index = begin;
+        range.begin = begin + 1;
+        range.end = end;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,497 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/TimeSeriesCodec.h>
+
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    // Worst case of a value: the two bits of the control, the leading zeros, the length and the whole value.
+    const size_t MAX_OVERHEAD_BITS = 13;
+
+    const unsigned LEADING_ZEROS_BITS = 5;
+
+    const unsigned MAX_LEADING_ZEROS = (1 << LEADING_ZEROS_BITS) - 1;
+
+    inline unsigned countLeadingZeros(uint64_t value)
+    {
+#if defined(__GNUC__)
+        return (unsigned)__builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return 63 - (unsigned)index;
+#else
+        unsigned count = 0;
+
+        for(uint64_t mask = 1ull << 63; (value & mask) == 0; mask >>= 1)
+            ++count;
+
+        return count;
+#endif
+    }
+
+    inline unsigned countTrailingZeros(uint64_t value)
+    {
+#if defined(__GNUC__)
+        return (unsigned)__builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return (unsigned)index;
+#else
+        unsigned count = 0;
+
+        for(; (value & 1) == 0; value >>= 1)
+            ++count;
+
+        return count;
+#endif
+    }
+
+    // Writes bits most significant first, flushing them 32 at a time.
+    class BitWriter
+    {
+        public:
+
+            BitWriter(char *destination) : m_destination(destination), m_position(0), m_buffer(0), m_bits(0) {}
+
+            // Up to 32 bits.
+            inline void write(uint64_t value, unsigned numBits)
+            {
+                m_buffer = (m_buffer << numBits) | value;
+                m_bits += numBits;
+
+                if(m_bits >= 32)
+                {
+                    m_bits -= 32;
+                    uint32_t word = (uint32_t)(m_buffer >> m_bits);
+                    m_destination[m_position] = (char)(word >> 24);
+                    m_destination[m_position + 1] = (char)(word >> 16);
+                    m_destination[m_position + 2] = (char)(word >> 8);
+                    m_destination[m_position + 3] = (char)word;
+                    m_position += 4;
+                }
+            }
+
+            // Up to 64 bits.
+            inline void writeLong(uint64_t value, unsigned numBits)
+            {
+                if(numBits > 32)
+                {
+                    write(value >> 32, numBits - 32);
+                    write(value & 0xffffffffull, 32);
+                }
+                else
+                    write(value, numBits);
+            }
+
+            size_t finish()
+            {
+                while(m_bits >= 8)
+                {
+                    m_bits -= 8;
+                    m_destination[m_position++] = (char)(m_buffer >> m_bits);
+                }
+
+                if(m_bits > 0)
+                    m_destination[m_position++] = (char)(m_buffer << (8 - m_bits));
+
+                m_bits = 0;
+                return m_position;
+            }
+
+        private:
+
+            char *m_destination;
+
+            size_t m_position;
+
+            uint64_t m_buffer;
+
+            unsigned m_bits;
+    };
+
+    // Reads bits most significant first. Past the end it reads zeros and remembers the overrun.
+    class BitReader
+    {
+        public:
+
+            BitReader(const char *source, size_t size) : m_source((const uint8_t*)source), m_size(size), m_position(0),
+                m_buffer(0), m_bits(0), m_consumed(0) {}
+
+            // From 1 up to 32 bits.
+            inline uint64_t read(unsigned numBits)
+            {
+                if(m_bits < numBits)
+                    refill();
+
+                uint64_t value = m_buffer >> (64 - numBits);
+                m_buffer <<= numBits;
+                m_bits -= numBits;
+                m_consumed += numBits;
+                return value;
+            }
+
+            // From 1 up to 64 bits.
+            inline uint64_t readLong(unsigned numBits)
+            {
+                if(numBits > 32)
+                {
+                    uint64_t high = read(numBits - 32);
+                    return (high << 32) | read(32);
+                }
+
+                return read(numBits);
+            }
+
+            inline bool good() const { return m_consumed <= (uint64_t)m_size * 8;}
+
+        private:
+
+            void refill()
+            {
+                if(m_position + 8 <= m_size)
+                {
+                    uint64_t word = 0;
+
+                    for(size_t index = 0; index < 8; ++index)
+                        word = (word << 8) | m_source[m_position + index];
+
+                    // Only whole bytes are taken.
+                    unsigned numBytes = (64 - m_bits) / 8;
+
+                    if(numBytes < 8)
+                        word = (word >> (64 - numBytes * 8)) << (64 - numBytes * 8);
+
+                    m_buffer |= word >> m_bits;
+                    m_bits += numBytes * 8;
+                    m_position += numBytes;
+                    return;
+                }
+
+                while(m_bits <= 56)
+                {
+                    uint64_t byte = m_position < m_size ? m_source[m_position] : 0;
+                    m_buffer |= byte << (56 - m_bits);
+                    m_bits += 8;
+                    ++m_position;
+                }
+            }
+
+            const uint8_t *m_source;
+
+            size_t m_size;
+
+            size_t m_position;
+
+            uint64_t m_buffer;
+
+            unsigned m_bits;
+
+            uint64_t m_consumed;
+    };
+
+    template<class _T, class _U>
+        inline _U toBits(_T value)
+        {
+            _U bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+    template<class _T, class _U>
+        inline _T fromBits(_U bits)
+        {
+            _T value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+    /*
+     * XOR encoding of floating point values _T, through their bit pattern _U. Each value is encoded as:
+     *   '0'                                          same as the previous value.
+     *   '10' meaningful bits                         the XOR fits in the window of the previous XOR.
+     *   '11' leading zeros, length, meaningful bits  new window.
+     */
+    template<class _T, class _U>
+        size_t encodeXor(const _T *value_t, size_t numElements, char *destination)
+        {
+            const unsigned width = sizeof(_U) * 8;
+            const unsigned lengthBits = width == 64 ? 6 : 5;
+            BitWriter writer(destination);
+
+            if(numElements == 0)
+                return 0;
+
+            _U previous = toBits<_T, _U>(value_t[0]);
+            unsigned previousLeading = width;
+            unsigned previousTrailing = 0;
+            writer.writeLong(previous, width);
+
+            for(size_t count = 1; count < numElements; ++count)
+            {
+                _U value = toBits<_T, _U>(value_t[count]);
+                _U xored = value ^ previous;
+                previous = value;
+
+                if(xored == 0)
+                {
+                    writer.write(0, 1);
+                    continue;
+                }
+
+                unsigned leading = countLeadingZeros(xored) - (64 - width);
+                unsigned trailing = countTrailingZeros(xored);
+
+                if(leading > MAX_LEADING_ZEROS)
+                    leading = MAX_LEADING_ZEROS;
+
+                if(leading >= previousLeading && trailing >= previousTrailing)
+                {
+                    writer.write(2, 2);
+                    writer.writeLong(xored >> previousTrailing, width - previousLeading - previousTrailing);
+                }
+                else
+                {
+                    unsigned length = width - leading - trailing;
+                    writer.write(3, 2);
+                    writer.write(leading, LEADING_ZEROS_BITS);
+                    writer.write(length == width ? 0 : length, lengthBits);
+                    writer.writeLong(xored >> trailing, length);
+                    previousLeading = leading;
+                    previousTrailing = trailing;
+                }
+            }
+
+            return writer.finish();
+        }
+
+    template<class _T, class _U>
+        bool decodeXor(const char *source, size_t size, _T *value_t, size_t numElements)
+        {
+            const unsigned width = sizeof(_U) * 8;
+            const unsigned lengthBits = width == 64 ? 6 : 5;
+            BitReader reader(source, size);
+
+            if(numElements == 0)
+                return true;
+
+            _U previous = (_U)reader.readLong(width);
+            unsigned previousLeading = width;
+            unsigned previousTrailing = 0;
+            value_t[0] = fromBits<_T, _U>(previous);
+
+            for(size_t count = 1; count < numElements; ++count)
+            {
+                if(reader.read(1) != 0)
+                {
+                    if(reader.read(1) == 0)
+                    {
+                        if(previousLeading == width)
+                            return false;
+                    }
+                    else
+                    {
+                        unsigned leading = (unsigned)reader.read(LEADING_ZEROS_BITS);
+                        unsigned length = (unsigned)reader.read(lengthBits);
+
+                        if(length == 0)
+                            length = width;
+
+                        if(leading + length > width)
+                            return false;
+
+                        previousLeading = leading;
+                        previousTrailing = width - leading - length;
+                    }
+
+                    previous ^= (_U)(reader.readLong(width - previousLeading - previousTrailing) << previousTrailing);
+                }
+
+                value_t[count] = fromBits<_T, _U>(previous);
+            }
+
+            return reader.good();
+        }
+
+    /*
+     * Delta of delta encoding of integers, seen as the unsigned integer _U with wrapping arithmetic.
+     * The zigzag encoded difference between consecutive deltas uses a prefix code:
+     *   '0' zero, '10' 7 bits, '110' 9 bits, '1110' 12 bits, '11110' 32 bits, '11111' the whole width.
+     */
+    template<class _U>
+        size_t encodeDeltaOfDelta(const _U *value_t, size_t numElements, char *destination)
+        {
+            const unsigned width = sizeof(_U) * 8;
+            BitWriter writer(destination);
+
+            if(numElements == 0)
+                return 0;
+
+            _U previous = value_t[0];
+            _U previousDelta = 0;
+            writer.writeLong(previous, width);
+
+            for(size_t count = 1; count < numElements; ++count)
+            {
+                _U delta = (_U)(value_t[count] - previous);
+                _U deltaOfDelta = (_U)(delta - previousDelta);
+                _U zigzag = (_U)((_U)(deltaOfDelta << 1) ^ (_U)(0 - (deltaOfDelta >> (width - 1))));
+                previous = value_t[count];
+                previousDelta = delta;
+
+                if(zigzag == 0)
+                    writer.write(0, 1);
+                else if((zigzag >> 7) == 0)
+                {
+                    writer.write(2, 2);
+                    writer.write(zigzag, 7);
+                }
+                else if((zigzag >> 9) == 0)
+                {
+                    writer.write(6, 3);
+                    writer.write(zigzag, 9);
+                }
+                else if((zigzag >> 12) == 0)
+                {
+                    writer.write(14, 4);
+                    writer.write(zigzag, 12);
+                }
+                else if(((uint64_t)zigzag >> 32) == 0)
+                {
+                    writer.write(30, 5);
+                    writer.write(zigzag, 32);
+                }
+                else
+                {
+                    writer.write(31, 5);
+                    writer.writeLong(zigzag, width);
+                }
+            }
+
+            return writer.finish();
+        }
+
+    template<class _U>
+        bool decodeDeltaOfDelta(const char *source, size_t size, _U *value_t, size_t numElements)
+        {
+            const unsigned width = sizeof(_U) * 8;
+            BitReader reader(source, size);
+
+            if(numElements == 0)
+                return true;
+
+            _U previous = (_U)reader.readLong(width);
+            _U previousDelta = 0;
+            value_t[0] = previous;
+
+            for(size_t count = 1; count < numElements; ++count)
+            {
+                _U zigzag = 0;
+
+                if(reader.read(1) != 0)
+                {
+                    if(reader.read(1) == 0)
+                        zigzag = (_U)reader.read(7);
+                    else if(reader.read(1) == 0)
+                        zigzag = (_U)reader.read(9);
+                    else if(reader.read(1) == 0)
+                        zigzag = (_U)reader.read(12);
+                    else if(reader.read(1) == 0)
+                        zigzag = (_U)reader.read(32);
+                    else
+                        zigzag = (_U)reader.readLong(width);
+                }
+
+                _U deltaOfDelta = (_U)((zigzag >> 1) ^ (_U)(0 - (zigzag & 1)));
+                previousDelta = (_U)(previousDelta + deltaOfDelta);
+                previous = (_U)(previous + previousDelta);
+                value_t[count] = previous;
+            }
+
+            return reader.good();
+        }
+}
+
+size_t TimeSeriesCodec::getMaxEncodedSize(size_t numElements, size_t elementSize)
+{
+    return (numElements * (elementSize * 8 + MAX_OVERHEAD_BITS) + 7) / 8;
+}
+
+size_t TimeSeriesCodec::encode(const double *double_t, size_t numElements, char *destination)
+{
+    return encodeXor<double, uint64_t>(double_t, numElements, destination);
+}
+
+size_t TimeSeriesCodec::encode(const float *float_t, size_t numElements, char *destination)
+{
+    return encodeXor<float, uint32_t>(float_t, numElements, destination);
+}
+
+size_t TimeSeriesCodec::encode(const int64_t *longlong_t, size_t numElements, char *destination)
+{
+    return encodeDeltaOfDelta(reinterpret_cast<const uint64_t*>(longlong_t), numElements, destination);
+}
+
+size_t TimeSeriesCodec::encode(const uint64_t *ulonglong_t, size_t numElements, char *destination)
+{
+    return encodeDeltaOfDelta(ulonglong_t, numElements, destination);
+}
+
+size_t TimeSeriesCodec::encode(const int32_t *long_t, size_t numElements, char *destination)
+{
+    return encodeDeltaOfDelta(reinterpret_cast<const uint32_t*>(long_t), numElements, destination);
+}
+
+size_t TimeSeriesCodec::encode(const uint32_t *ulong_t, size_t numElements, char *destination)
+{
+    return encodeDeltaOfDelta(ulong_t, numElements, destination);
+}
+
+bool TimeSeriesCodec::decode(const char *source, size_t size, double *double_t, size_t numElements)
+{
+    return decodeXor<double, uint64_t>(source, size, double_t, numElements);
+}
+
+bool TimeSeriesCodec::decode(const char *source, size_t size, float *float_t, size_t numElements)
+{
+    return decodeXor<float, uint32_t>(source, size, float_t, numElements);
+}
+
+bool TimeSeriesCodec::decode(const char *source, size_t size, int64_t *longlong_t, size_t numElements)
+{
+    return decodeDeltaOfDelta(source, size, reinterpret_cast<uint64_t*>(longlong_t), numElements);
+}
+
+bool TimeSeriesCodec::decode(const char *source, size_t size, uint64_t *ulonglong_t, size_t numElements)
+{
+    return decodeDeltaOfDelta(source, size, ulonglong_t, numElements);
+}
+
+bool TimeSeriesCodec::decode(const char *source, size_t size, int32_t *long_t, size_t numElements)
+{
+    return decodeDeltaOfDelta(source, size, reinterpret_cast<uint32_t*>(long_t), numElements);
+}
+
+bool TimeSeriesCodec::decode(const char *source, size_t size, uint32_t *ulong_t, size_t numElements)
+{
+    return decodeDeltaOfDelta(source, size, ulong_t, numElements);
+}
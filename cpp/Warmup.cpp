@@ -0,0 +1,124 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/Warmup.h>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace eprosima::fastcdr;
+
+namespace
+{
+    size_t pageSize()
+    {
+#if !defined(_WIN32)
+        static const size_t size = (size_t)sysconf(_SC_PAGESIZE);
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+    // Touches every page of a memory region, writing them in place or only reading them, and optionally locks them.
+    bool touch(char *data, size_t size, bool write, bool lock)
+    {
+        if(data == NULL || size == 0)
+            return true;
+
+#if !defined(_WIN32) && defined(MADV_WILLNEED)
+        // madvise() needs a page aligned address.
+        uintptr_t begin = (uintptr_t)data / pageSize() * pageSize();
+        madvise((void*)begin, (uintptr_t)data + size - begin, MADV_WILLNEED);
+#endif
+
+        volatile char *page = data;
+
+        if(write)
+        {
+            // Writing, not reading, so the pages are really allocated and not mapped to the zero page.
+            for(size_t offset = 0; offset < size; offset += pageSize())
+                page[offset] = page[offset];
+
+            page[size - 1] = page[size - 1];
+        }
+        else
+        {
+            // Memory of the user may be read-only or written by other threads, so it is only read.
+            char sink = 0;
+
+            for(size_t offset = 0; offset < size; offset += pageSize())
+                sink ^= page[offset];
+
+            sink ^= page[size - 1];
+            (void)sink;
+        }
+
+        if(lock)
+        {
+#if !defined(_WIN32)
+            return mlock(data, size) == 0;
+#else
+            return false;
+#endif
+        }
+
+        return true;
+    }
+}
+
+bool Warmup::prefault(char *data, size_t size, bool lock)
+{
+    return touch(data, size, false, lock);
+}
+
+bool Warmup::prefault(FastBuffer &buffer, size_t size, bool lock)
+{
+    bool grown = buffer.reserve(size);
+    bool prefaulted = touch(buffer.getPacket(), buffer.getPacketLength(buffer.getBufferSize()), buffer.isInternalBuffer(), lock);
+    return grown && prefaulted;
+}
+
+bool Warmup::unlock(char *data, size_t size)
+{
+    if(data == NULL || size == 0)
+        return true;
+
+#if !defined(_WIN32)
+    return munlock(data, size) == 0;
+#else
+    return false;
+#endif
+}
+
+bool Warmup::unlock(FastBuffer &buffer)
+{
+    return unlock(buffer.getPacket(), buffer.getPacketLength(buffer.getBufferSize()));
+}
+
+void Warmup::run(size_t iterations)
+{
+    FastBuffer buffer;
+
+    for(size_t type = 0; type < m_types.size(); ++type)
+    {
+        for(size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            m_types[type](buffer, Cdr::BIG_ENDIANNESS);
+            m_types[type](buffer, Cdr::LITTLE_ENDIANNESS);
+        }
+    }
+}
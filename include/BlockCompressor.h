@@ -0,0 +1,109 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_BLOCKCOMPRESSOR_H_
+#define _FASTCDR_BLOCKCOMPRESSOR_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include <stdint.h>
+#include <cstddef>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class compresses serialized payloads with a LZ77 block codec tuned for decompression speed.
+         * The payload is stored in a frame: a header with a magic number, the method, the original length and the length of the compressed data,
+         * all little endian, followed by the data. Payloads that are short or do not compress well enough are stored uncompressed,
+         * so a frame is never much longer than its payload.
+         * The functions taking eprosima::fastcdr::FastBuffer objects work as a stage after the serialization:
+         * the payload is compressed into a second buffer, or decompressed into a buffer that is then deserialized.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI BlockCompressor
+        {
+            public:
+
+                //! @brief Size of the header of a frame.
+                static const size_t FRAME_HEADER_SIZE;
+
+                //! @brief Payloads shorter than this are always stored uncompressed.
+                static const size_t MIN_COMPRESSIBLE_LENGTH;
+
+                /*!
+                 * @brief This function returns the maximum size of the frame of a payload.
+                 * @param length The length of the payload.
+                 * @return The size in bytes.
+                 */
+                static size_t getMaxFrameSize(size_t length);
+
+                /*!
+                 * @brief This function stores a payload in a frame, compressed if that saves at least 1/16 of its length.
+                 * @param source The payload.
+                 * @param length The length of the payload.
+                 * @param destination The memory where the frame is written. Its size has to be eprosima::fastcdr::BlockCompressor::getMaxFrameSize.
+                 * @return The size of the frame.
+                 */
+                static size_t compress(const char *source, size_t length, char *destination);
+
+                /*!
+                 * @brief This function stores the beginning of a buffer in a frame at the beginning of another buffer, growing it if needed.
+                 * @param source The buffer with the payload.
+                 * @param length The length of the payload.
+                 * @param destination The buffer where the frame is written.
+                 * @return The size of the frame.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the destination buffer cannot hold the frame.
+                 */
+                static size_t compress(const FastBuffer &source, size_t length, FastBuffer &destination);
+
+                /*!
+                 * @brief This function returns the length of the payload of a frame.
+                 * @param frame The frame.
+                 * @param size The size of the frame.
+                 * @return The length of the payload.
+                 * @exception exception::BadParamException This exception is thrown when the frame header is malformed or truncated,
+                 * or when its length cannot be produced from its compressed data.
+                 */
+                static size_t getPayloadLength(const char *frame, size_t size);
+
+                /*!
+                 * @brief This function restores the payload of a frame.
+                 * @param frame The frame.
+                 * @param size The size of the frame.
+                 * @param destination The memory where the payload is written.
+                 * @param destinationSize The size of the memory. It has to be at least eprosima::fastcdr::BlockCompressor::getPayloadLength.
+                 * @return The length of the payload.
+                 * @exception exception::BadParamException This exception is thrown when the frame is malformed or truncated.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the memory cannot hold the payload.
+                 */
+                static size_t decompress(const char *frame, size_t size, char *destination, size_t destinationSize);
+
+                /*!
+                 * @brief This function restores the payload of a frame at the beginning of a buffer into another buffer, growing it if needed.
+                 * The eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using the destination buffer have to be reset after this call.
+                 * @param source The buffer with the frame.
+                 * @param size The size of the frame.
+                 * @param destination The buffer where the payload is written.
+                 * @return The length of the payload.
+                 * @exception exception::BadParamException This exception is thrown when the frame is malformed or truncated.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the destination buffer cannot hold the payload.
+                 */
+                static size_t decompress(const FastBuffer &source, size_t size, FastBuffer &destination);
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_BLOCKCOMPRESSOR_H_
@@ -0,0 +1,112 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_BOOLPACKING_H_
+#define _FASTCDR_BOOLPACKING_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers the kernels that convert booleans between their memory representation and
+         * the CDR representation, one byte per boolean, or the packed representation, eight booleans per byte.
+         * In the packed representation the first boolean is the least significant bit of the first byte and the unused bits of the last byte are zero.
+         * Sixteen booleans are processed at once with SSE2 when it is available and eight at once otherwise.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI BoolPacking
+        {
+            public:
+
+                /*!
+                 * @brief This function returns the size of the packed representation of an array of booleans.
+                 * @param numElements Number of the elements in the array.
+                 * @return The size in bytes.
+                 */
+                static inline size_t getPackedSize(size_t numElements) { return (numElements + 7) / 8;}
+
+                /*!
+                 * @brief This function packs an array of booleans, eight booleans per byte.
+                 * @param bool_t The array of booleans.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the packed booleans are written. Its size has to be eprosima::fastcdr::BoolPacking::getPackedSize.
+                 */
+                static void pack(const bool *bool_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function unpacks an array of booleans packed eight per byte.
+                 * @param source The packed booleans.
+                 * @param numElements Number of the elements in the array.
+                 * @param bool_t The array that will store the booleans.
+                 * @return False if the unused bits of the last byte are not zero. In that case the array is not modified.
+                 */
+                static bool unpack(const char *source, size_t numElements, bool *bool_t);
+
+                /*!
+                 * @brief This function packs a vector of booleans, eight booleans per byte.
+                 * @param vector_t The vector of booleans.
+                 * @param destination The memory where the packed booleans are written. Its size has to be eprosima::fastcdr::BoolPacking::getPackedSize.
+                 */
+                static void pack(const std::vector<bool> &vector_t, char *destination);
+
+                /*!
+                 * @brief This function unpacks booleans packed eight per byte into a vector.
+                 * @param source The packed booleans.
+                 * @param vector_t The vector that will store the booleans. Its size is the number of booleans unpacked.
+                 * @return False if the unused bits of the last byte are not zero. In that case the vector is not modified.
+                 */
+                static bool unpack(const char *source, std::vector<bool> &vector_t);
+
+                /*!
+                 * @brief This function writes an array of booleans in the CDR representation, one byte with value 0 or 1 per boolean.
+                 * @param bool_t The array of booleans.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the bytes are written.
+                 */
+                static void toBytes(const bool *bool_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function reads an array of booleans in the CDR representation and checks that every byte is 0 or 1.
+                 * @param source The bytes.
+                 * @param numElements Number of the elements in the array.
+                 * @param bool_t The array that will store the booleans.
+                 * @return False if a byte is not 0 or 1. In that case the array is only partially filled.
+                 */
+                static bool fromBytes(const char *source, size_t numElements, bool *bool_t);
+
+                /*!
+                 * @brief This function writes a vector of booleans in the CDR representation, one byte with value 0 or 1 per boolean.
+                 * @param vector_t The vector of booleans.
+                 * @param destination The memory where the bytes are written.
+                 */
+                static void toBytes(const std::vector<bool> &vector_t, char *destination);
+
+                /*!
+                 * @brief This function reads booleans in the CDR representation into a vector and checks that every byte is 0 or 1.
+                 * @param source The bytes.
+                 * @param vector_t The vector that will store the booleans. Its size is the number of booleans read.
+                 * @return False if a byte is not 0 or 1. In that case the vector is only partially filled.
+                 */
+                static bool fromBytes(const char *source, std::vector<bool> &vector_t);
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_BOOLPACKING_H_
@@ -0,0 +1,143 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_BUFFERTRIMMER_H_
+#define _FASTCDR_BUFFERTRIMMER_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include <stdint.h>
+#include <cstddef>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class gives back to the system the memory of registered eprosima::fastcdr::FastBuffer objects that are not being used.
+         * The internal stream of a buffer idle for longer than a threshold is deallocated. When the total size of the registered streams
+         * exceeds a memory budget, the streams idle for longer are deallocated first until the total fits in the budget.
+         * A buffer is only trimmed between eprosima::fastcdr::BufferTrimmer::release and eprosima::fastcdr::BufferTrimmer::acquire,
+         * so the eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using it have to be reset after acquiring it.
+         * Trimming can be run explicitly with eprosima::fastcdr::BufferTrimmer::trim or periodically by a thread of the trimmer.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI BufferTrimmer
+        {
+            public:
+
+                /*!
+                 * @brief This constructor creates a trimmer without buffers.
+                 * @param idleThresholdMs Time in milliseconds after which an idle buffer is trimmed. 0 disables trimming by idleness.
+                 * @param memoryBudget Maximum total size of the registered streams. 0 disables the budget.
+                 */
+                BufferTrimmer(uint32_t idleThresholdMs, size_t memoryBudget = 0);
+
+                /*!
+                 * @brief Default destructor. It stops the periodic trimming.
+                 */
+                virtual ~BufferTrimmer();
+
+                /*!
+                 * @brief This function registers a buffer. The buffer is idle after registering it.
+                 * @param buffer The buffer. It has to be unregistered before it is destroyed.
+                 */
+                void add(FastBuffer &buffer);
+
+                /*!
+                 * @brief This function unregisters a buffer.
+                 * @param buffer The buffer.
+                 */
+                void remove(FastBuffer &buffer);
+
+                /*!
+                 * @brief This function marks a registered buffer as in use, so it is not trimmed until it is released.
+                 * @param buffer The buffer.
+                 */
+                void acquire(FastBuffer &buffer);
+
+                /*!
+                 * @brief This function marks a registered buffer as idle from now on.
+                 * @param buffer The buffer.
+                 */
+                void release(FastBuffer &buffer);
+
+                /*!
+                 * @brief This function trims the idle buffers according to the idle threshold and the memory budget.
+                 * @return The number of bytes given back to the system.
+                 */
+                size_t trim();
+
+                /*!
+                 * @brief This function returns the total size of the streams of the registered buffers.
+                 * @return The total size.
+                 */
+                size_t getTotalSize();
+
+                /*!
+                 * @brief This function starts a thread that calls eprosima::fastcdr::BufferTrimmer::trim periodically.
+                 * @param periodMs The period in milliseconds.
+                 */
+                void start(uint32_t periodMs);
+
+                /*!
+                 * @brief This function stops the periodic trimming.
+                 */
+                void stop();
+
+            private:
+
+                BufferTrimmer(const BufferTrimmer&) NON_COPYABLE_CXX11;
+
+                BufferTrimmer& operator=(const BufferTrimmer&) NON_COPYABLE_CXX11;
+
+                //! @brief Usage state of a registered buffer.
+                struct Usage
+                {
+                    bool busy;
+                    std::chrono::steady_clock::time_point lastUse;
+                };
+
+                //! @brief Frees the stream of a buffer and returns its size.
+                static size_t trimBuffer(FastBuffer &buffer);
+
+                std::chrono::milliseconds m_idleThreshold;
+
+                size_t m_memoryBudget;
+
+                //! @brief Protects m_buffers.
+                std::mutex m_mutex;
+
+                std::map<FastBuffer*, Usage> m_buffers;
+
+                //! @brief Thread of the periodic trimming.
+                std::thread m_thread;
+
+                //! @brief Protects m_running.
+                std::mutex m_threadMutex;
+
+                //! @brief Signalled to stop the periodic trimming.
+                std::condition_variable m_threadCondition;
+
+                bool m_running;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_BUFFERTRIMMER_H_
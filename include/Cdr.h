@@ -17,10 +17,14 @@
 
 #include "fastcdr_dll.h"
 #include "FastBuffer.h"
+#include "QuantizationCodec.h"
+#include "StringDictionary.h"
 #include "exceptions/NotEnoughMemoryException.h"
+#include "exceptions/BadParamException.h"
 #include <stdint.h>
 #include <string>
 #include <vector>
+#include <type_traits>
 
 #if !__APPLE__
 #include <malloc.h>
@@ -36,6 +40,8 @@ namespace eprosima
 {
     namespace fastcdr
     {
+        class ThreadPool;
+
         /*!
          * @brief This class offers an interface to serialize/deserialize some basic types using CDR protocol inside an eprosima::fastcdr::FastBuffer.
          * @ingroup FASTCDRAPIREFERENCE
@@ -65,6 +71,53 @@ namespace eprosima
                         DDS_CDR_WITH_PL = 0x2
                     } DDSCdrPlFlag;
 
+                /*!
+                 * @brief This enumeration represents the encoding algorithms of the encapsulation, without the endianness bit.
+                 * The XCDR2 encodings align primitive types to 4 bytes at most.
+                 */
+                typedef enum
+#ifdef HAVE_CXX0X
+                    : uint8_t
+#endif
+                    {
+                        //! @brief XCDR1 plain encoding.
+                        PLAIN_CDR = 0x0,
+                        //! @brief XCDR1 parameter list encoding.
+                        PL_CDR = 0x2,
+                        //! @brief XCDR2 plain encoding, for final types.
+                        PLAIN_CDR2 = 0x6,
+                        //! @brief XCDR2 encoding with delimiters, for appendable types.
+                        DELIMIT_CDR2 = 0x8,
+                        //! @brief XCDR2 parameter list encoding, for mutable types.
+                        PL_CDR2 = 0xa
+                    } EncodingAlgorithmFlag;
+
+                /*!
+                 * @brief This enumeration represents the length codes of an XCDR2 member header (EMHEADER).
+                 */
+                typedef enum
+#ifdef HAVE_CXX0X
+                    : uint8_t
+#endif
+                    {
+                        //! @brief The member is 1 byte long.
+                        EMHEADER_LC_1 = 0,
+                        //! @brief The member is 2 bytes long.
+                        EMHEADER_LC_2 = 1,
+                        //! @brief The member is 4 bytes long.
+                        EMHEADER_LC_4 = 2,
+                        //! @brief The member is 8 bytes long.
+                        EMHEADER_LC_8 = 3,
+                        //! @brief The member length follows the header.
+                        EMHEADER_LC_NEXTINT = 4,
+                        //! @brief The member starts with its DHEADER, which also gives its length.
+                        EMHEADER_LC_DHEADER = 5,
+                        //! @brief The member starts with a length counting 4-byte elements.
+                        EMHEADER_LC_4_ELEMENTS = 6,
+                        //! @brief The member starts with a length counting 8-byte elements.
+                        EMHEADER_LC_8_ELEMENTS = 7
+                    } EMHeaderLengthCode;
+
                 /*!
                  * @brief This enumeration represents endianness types.
                  */
@@ -174,6 +227,7 @@ namespace eprosima
 
                 /*!
                  * @brief This function resets the current position in the buffer to the beginning.
+                 * It also picks up the stream set in the buffer with eprosima::fastcdr::FastBuffer::setBuffer.
                  */
                 void reset();
 
@@ -194,6 +248,12 @@ namespace eprosima
                  */
                 inline size_t getSerializedDataLength() const { return m_currentPosition - m_cdrBuffer.begin();}
 
+                /*!
+                 * @brief This function returns the number of bytes between the current position and the end of the stream.
+                 * @return The length of the data left in the stream.
+                 */
+                inline size_t getRemainingDataLength() const { return m_lastPosition - m_currentPosition;}
+
                 /*! TODO */
                 inline static size_t alignment(size_t current_alignment, size_t dataSize) { return (dataSize - (current_alignment % dataSize)) & (dataSize-1);}
 
@@ -216,6 +276,520 @@ namespace eprosima
                  */
                 inline void resetAlignment(){m_alignPosition = m_currentPosition;}
 
+                /*!
+                 * @brief This function enables the parallel copy of large arrays of primitive types.
+                 * Arrays of 2, 4 and 8 bytes types whose size reaches the threshold are split in chunks copied (and swapped if needed) by the threads of the pool.
+                 * @param pool The thread pool used to copy the arrays. NULL disables the parallel copy.
+                 * @param threshold The minimum size in bytes of an array to be copied in parallel.
+                 */
+                void setParallelCopy(ThreadPool *pool, size_t threshold = DEFAULT_PARALLEL_THRESHOLD);
+
+                //! @brief Default minimum size in bytes of an array to be copied in parallel.
+                static const size_t DEFAULT_PARALLEL_THRESHOLD;
+
+                /*!
+                 * @brief This function returns the encoding algorithm of the stream.
+                 * It is set by eprosima::fastcdr::Cdr::read_encapsulation when an XCDR2 encapsulation is read.
+                 * @return The encoding algorithm.
+                 */
+                EncodingAlgorithmFlag getEncodingAlgorithm() const;
+
+                /*!
+                 * @brief This function sets the encoding algorithm serialized by eprosima::fastcdr::Cdr::serialize_encapsulation.
+                 * The XCDR2 encodings limit the alignment of the primitive types to 4 bytes from now on.
+                 * The XCDR1 encodings also set the parameter list flag.
+                 * @param encoding The encoding algorithm.
+                 */
+                void setEncodingAlgorithm(EncodingAlgorithmFlag encoding);
+
+                /*!
+                 * @brief This function starts an XCDR2 delimited type: it reserves the DHEADER, filled by eprosima::fastcdr::Cdr::endSerializeDHeader.
+                 * @return The position of the DHEADER, to be passed to eprosima::fastcdr::Cdr::endSerializeDHeader.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                size_t beginSerializeDHeader();
+
+                /*!
+                 * @brief This function finishes an XCDR2 delimited type: it writes the length of the serialized type into its DHEADER.
+                 * @param position The position returned by eprosima::fastcdr::Cdr::beginSerializeDHeader.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 */
+                Cdr& endSerializeDHeader(size_t position);
+
+                /*!
+                 * @brief This function reads the DHEADER of an XCDR2 delimited type.
+                 * @return The length of the type after the DHEADER.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                uint32_t deserializeDHeader();
+
+                /*!
+                 * @brief This function skips a whole XCDR2 delimited type in constant time, jumping the length of its DHEADER.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the type exceeds the internal memory size.
+                 */
+                Cdr& skipDelimited();
+
+                /*!
+                 * @brief This function serializes an XCDR2 member header (EMHEADER) and, for the length codes that need it, its NEXTINT.
+                 * For eprosima::fastcdr::Cdr::EMHEADER_LC_DHEADER and the element counting length codes the NEXTINT is the beginning
+                 * of the member, so it is not serialized here.
+                 * @param memberId The identifier of the member. Only its 28 lower bits are used.
+                 * @param mustUnderstand True if the receiver has to understand the member.
+                 * @param lengthCode The length code.
+                 * @param nextInt The length of the member for eprosima::fastcdr::Cdr::EMHEADER_LC_NEXTINT.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeEMHeader(uint32_t memberId, bool mustUnderstand, EMHeaderLengthCode lengthCode, uint32_t nextInt = 0);
+
+                /*!
+                 * @brief This function starts an XCDR2 member of unknown length: it serializes an EMHEADER with length code
+                 * eprosima::fastcdr::Cdr::EMHEADER_LC_NEXTINT and reserves the NEXTINT, filled by eprosima::fastcdr::Cdr::endSerializeEMHeader.
+                 * @param memberId The identifier of the member.
+                 * @param mustUnderstand True if the receiver has to understand the member.
+                 * @return The position of the NEXTINT, to be passed to eprosima::fastcdr::Cdr::endSerializeEMHeader.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                size_t beginSerializeEMHeader(uint32_t memberId, bool mustUnderstand);
+
+                /*!
+                 * @brief This function finishes an XCDR2 member started with eprosima::fastcdr::Cdr::beginSerializeEMHeader.
+                 * @param position The position returned by eprosima::fastcdr::Cdr::beginSerializeEMHeader.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 */
+                inline Cdr& endSerializeEMHeader(size_t position) { return endSerializeDHeader(position);}
+
+                /*!
+                 * @brief This function reads an XCDR2 member header (EMHEADER) and the NEXTINT that only gives the length of the member.
+                 * After it, the member is deserialized or skipped in constant time with eprosima::fastcdr::Cdr::skipMember.
+                 * @param memberId The identifier of the member.
+                 * @param mustUnderstand True if the receiver has to understand the member.
+                 * @param memberSize The number of bytes of the member from the current position.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                Cdr& deserializeEMHeader(uint32_t &memberId, bool &mustUnderstand, size_t &memberSize);
+
+                /*!
+                 * @brief This function skips a member whose size was read with eprosima::fastcdr::Cdr::deserializeEMHeader.
+                 * @param memberSize The size of the member.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the member exceeds the internal memory size.
+                 */
+                Cdr& skipMember(size_t memberSize);
+
+                /*!
+                 * @brief Parameter identifier that ends a parameter list: PID_LIST_END of DDS-XTypes, the sentinel that goes with
+                 * eprosima::fastcdr::Cdr::PID_EXTENDED. The RTPS sentinel 0x0001 is an ordinary identifier in these lists.
+                 */
+                static const uint16_t PID_SENTINEL;
+
+                //! @brief Parameter identifier of the header of a parameter whose identifier or length does not fit in 16 bits (DDS-XTypes).
+                static const uint16_t PID_EXTENDED;
+
+                /*!
+                 * @brief This function starts a parameter of a parameter list: it serializes its header and reserves its length,
+                 * filled by eprosima::fastcdr::Cdr::endSerializeParameter. The alignment is reset to the beginning of the parameter value.
+                 * An extended header is used when the identifier does not fit in 14 bits.
+                 * @param pid The parameter identifier.
+                 * @return The position of the parameter header, where its identifier starts, to be passed to eprosima::fastcdr::Cdr::endSerializeParameter.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                size_t beginSerializeParameter(uint32_t pid);
+
+                /*!
+                 * @brief This function finishes a parameter of a parameter list: it pads the value to a multiple of 4 bytes and writes its length.
+                 * @param position The position returned by eprosima::fastcdr::Cdr::beginSerializeParameter.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the value is too long for a 16 bits length.
+                 */
+                Cdr& endSerializeParameter(size_t position);
+
+                /*!
+                 * @brief This function serializes the sentinel that ends a parameter list.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeParameterSentinel();
+
+                /*!
+                 * @brief This function reads the header of a parameter of a parameter list, extended or not.
+                 * The alignment is reset to the beginning of the parameter value.
+                 * @param pid The parameter identifier, including its flags. Without the flags, it is eprosima::fastcdr::Cdr::PID_SENTINEL at the end of the list.
+                 * @param length The length of the parameter value.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                Cdr& deserializeParameterHeader(uint32_t &pid, size_t &length);
+
+                /*!
+                 * @brief This function serializes an array of booleans packed eight per byte, the first boolean in the least significant bit.
+                 * This encoding is an extension, not part of the CDR standard; both sides have to agree on using it.
+                 * @param bool_t The array of booleans that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                Cdr& serializePackedBoolArray(const bool *bool_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of booleans packed eight per byte.
+                 * @param bool_t The variable that will store the array of booleans read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the unused bits of the last byte are not zero.
+                 */
+                Cdr& deserializePackedBoolArray(bool *bool_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes a sequence of booleans packed eight per byte: the number of booleans followed by the packed array.
+                 * @param vector_t The sequence of booleans that will be serialized in the buffer.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                Cdr& serializePackedBoolSequence(const std::vector<bool> &vector_t);
+
+                /*!
+                 * @brief This function deserializes a sequence of booleans packed eight per byte.
+                 * @param vector_t The variable that will store the sequence of booleans read from the buffer.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the unused bits of the last byte are not zero.
+                 */
+                Cdr& deserializePackedBoolSequence(std::vector<bool> &vector_t);
+
+                /*!
+                 * @brief This function serializes an array of doubles compressed as each value XORed with the previous one: the size of the compressed array followed by it.
+                 * This encoding is an extension, not part of the CDR standard. The values are restored exactly.
+                 * @param double_t The array of doubles that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeCompressedArray(const double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of floats compressed as each value XORed with the previous one: the size of the compressed array followed by it.
+                 * This encoding is an extension, not part of the CDR standard. The values are restored exactly.
+                 * @param float_t The array of floats that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeCompressedArray(const float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of long longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * This encoding is an extension, not part of the CDR standard. The values are restored exactly.
+                 * @param longlong_t The array of long longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeCompressedArray(const int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of unsigned long longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * This encoding is an extension, not part of the CDR standard. The values are restored exactly.
+                 * @param ulonglong_t The array of unsigned long longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeCompressedArray(const uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * This encoding is an extension, not part of the CDR standard. The values are restored exactly.
+                 * @param long_t The array of longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeCompressedArray(const int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of unsigned longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * This encoding is an extension, not part of the CDR standard. The values are restored exactly.
+                 * @param ulong_t The array of unsigned longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeCompressedArray(const uint32_t *ulong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of doubles.
+                 * @param double_t The variable that will store the array of doubles read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                Cdr& deserializeCompressedArray(double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of floats.
+                 * @param float_t The variable that will store the array of floats read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                Cdr& deserializeCompressedArray(float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of long longs.
+                 * @param longlong_t The variable that will store the array of long longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                Cdr& deserializeCompressedArray(int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of unsigned long longs.
+                 * @param ulonglong_t The variable that will store the array of unsigned long longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                Cdr& deserializeCompressedArray(uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of longs.
+                 * @param long_t The variable that will store the array of longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                Cdr& deserializeCompressedArray(int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of unsigned longs.
+                 * @param ulong_t The variable that will store the array of unsigned longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                Cdr& deserializeCompressedArray(uint32_t *ulong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of floats as half precision values, two bytes each. The values are rounded to nearest even.
+                 * This encoding is an extension, not part of the CDR standard.
+                 * @param float_t The array of floats that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeHalfArray(const float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of doubles as half precision values, two bytes each. The values are rounded to nearest even.
+                 * This encoding is an extension, not part of the CDR standard.
+                 * @param double_t The array of doubles that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeHalfArray(const double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of floats serialized as half precision values.
+                 * @param float_t The variable that will store the array of floats read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                Cdr& deserializeHalfArray(float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of doubles serialized as half precision values.
+                 * @param double_t The variable that will store the array of doubles read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                Cdr& deserializeHalfArray(double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of floats quantized over its range: the offset and the scale as floats followed by the codes.
+                 * This encoding is an extension, not part of the CDR standard.
+                 * @param float_t The array of floats that will be serialized in the buffer. The values that are not finite become the minimum.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeQuantizedArray(const float *float_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function serializes an array of doubles quantized over its range: the offset and the scale as floats followed by the codes.
+                 * This encoding is an extension, not part of the CDR standard.
+                 * @param double_t The array of doubles that will be serialized in the buffer. The values that are not finite become the minimum.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeQuantizedArray(const double *double_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function deserializes a quantized array of floats.
+                 * @param float_t The variable that will store the array of floats read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes, the same used to serialize the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                Cdr& deserializeQuantizedArray(float *float_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function deserializes a quantized array of doubles.
+                 * @param double_t The variable that will store the array of doubles read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes, the same used to serialize the array.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                Cdr& deserializeQuantizedArray(double *double_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function serializes a string through the dictionary of a batch: a reference followed by the string the first time,
+                 * and only the reference after that.
+                 * This encoding is an extension, not part of the CDR standard.
+                 * @param string_t The string that will be serialized in the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                Cdr& serializeDictionaryString(const char *string_t, StringDictionary &dictionary);
+
+                /*!
+                 * @brief This function serializes a std::string through the dictionary of a batch.
+                 * @param string_t The string that will be serialized in the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 */
+                inline
+                    Cdr& serializeDictionaryString(const std::string &string_t, StringDictionary &dictionary) {return serializeDictionaryString(string_t.c_str(), dictionary);}
+
+                /*!
+                 * @brief This function deserializes a string serialized through the dictionary of a batch, without copying it.
+                 * @param view_t The variable that will store the view of the string. It points to the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the reference is not in the dictionary.
+                 */
+                Cdr& deserializeDictionaryString(StringDictionary::View &view_t, StringDictionary &dictionary);
+
+                /*!
+                 * @brief This function deserializes a std::string serialized through the dictionary of a batch.
+                 * @param string_t The variable that will store the string read from the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the reference is not in the dictionary.
+                 */
+                inline
+                    Cdr& deserializeDictionaryString(std::string &string_t, StringDictionary &dictionary)
+                    {
+                        StringDictionary::View view;
+                        deserializeDictionaryString(view, dictionary);
+                        string_t.assign(view.data, view.length);
+                        return *this;
+                    }
+
+                /*!
+                 * @brief This function template returns a pointer to an array of primitive values in the buffer instead of copying it.
+                 * The array is read as eprosima::fastcdr::Cdr::deserializeArray would do. The array is aligned relative to the origin of the alignment,
+                 * which is 4 bytes after the encapsulation, so the pointer is only aligned to the size of 8 bytes elements when that origin is 8-aligned in memory.
+                 * @param array_t The variable that will store the pointer to the array in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return True if the array was read. False when it has to be copied, because it is an array of booleans or its bytes have to be swapped.
+                 * In that case the position is not moved.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class _T>
+                    bool deserializeArrayView(const _T *&array_t, size_t numElements)
+                    {
+                        if(std::is_same<_T, bool>::value || (m_swapBytes && sizeof(_T) > 1))
+                            return false;
+
+                        size_t align = alignment(sizeof(_T));
+                        size_t totalSize = sizeof(_T) * numElements;
+
+                        if((m_lastPosition - m_currentPosition) < totalSize + align)
+                            throw exception::NotEnoughMemoryException(exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                        // Save last datasize.
+                        m_lastDataSize = sizeof(_T);
+
+                        // Align if there are any elements
+                        if(numElements)
+                            makeAlign(align);
+
+                        array_t = reinterpret_cast<const _T*>(&m_currentPosition);
+                        m_currentPosition += totalSize;
+
+                        return true;
+                    }
+
+#if HAVE_CXX0X
+                /*!
+                 * @brief This function template deserializes a sequence of structures of primitive members directly into one std::vector per member,
+                 * without building the structures. The alignment and the byte swapping are the same as deserializing the structures member by member.
+                 * Structures of two, three or four members of 4 bytes, like points of floats, are transposed with SIMD shuffles.
+                 * @param columns The std::vector objects that will store the members, in serialization order. They are resized to the length of the sequence.
+                 * Booleans are not supported.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _T>
+                    Cdr& deserializeSequenceColumns(std::vector<_T>&... columns)
+                    {
+                        const size_t sizes[] = {sizeof(_T)...};
+                        const size_t numMembers = sizeof...(_T);
+                        size_t recordSize = 0;
+                        uint32_t seqLength = 0;
+                        state state(*this);
+
+                        for(size_t member = 0; member < numMembers; ++member)
+                            recordSize += sizes[member];
+
+                        *this >> seqLength;
+
+                        try
+                        {
+                            // Checked before resizing, so a corrupted length does not allocate.
+                            if((m_lastPosition - m_currentPosition) / recordSize < seqLength)
+                                throw exception::NotEnoughMemoryException(exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                            int resized[] = {(columns.resize(seqLength), 0)...};
+                            (void)resized;
+                            void *const data[] = {static_cast<void*>(columns.data())...};
+
+                            deserializeColumns(sizes, numMembers, data, seqLength);
+                        }
+                        catch(exception::Exception &ex)
+                        {
+                            setState(state);
+                            ex.raise();
+                        }
+
+                        return *this;
+                    }
+#endif
+
                 /*!
                  * @brief This operator serializes an octet.
                  * @param octet_t The value of the octet that will be serialized in the buffer.
@@ -1294,6 +1868,123 @@ namespace eprosima
                         return *this;
                     }
 
+                /*!
+                 * @brief This function template serializes a sequence using the threads of a pool.
+                 * The serialized sizes of the elements are computed in parallel for every possible starting alignment,
+                 * the starting offsets are obtained with a prefix sum and then the elements are serialized concurrently
+                 * into disjoint regions of the buffer. The result is byte-identical to eprosima::fastcdr::Cdr::serialize(const std::vector<_T>&).
+                 * @param vector_t The sequence that will be serialized in the buffer.
+                 * @param pool The thread pool used to compute the sizes and serialize the elements.
+                 * @param getSerializedSize Function object called as getSerializedSize(element, current_alignment).
+                 * It returns the number of bytes, padding included, of the element serialized at the given offset from the alignment origin.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when getSerializedSize does not match the serialized data.
+                 */
+                template<class _T, class _SizeFunc>
+                    Cdr& serializeParallel(const std::vector<_T> &vector_t, ThreadPool &pool, _SizeFunc getSerializedSize)
+                    {
+                        const size_t residues = 8;
+                        state state(*this);
+
+                        *this << (int32_t)vector_t.size();
+
+                        try
+                        {
+                            const size_t numElements = vector_t.size();
+                            const size_t maxChunks = getNumThreads(pool) * 4;
+
+                            if(numElements == 0)
+                                return *this;
+
+                            // Every chunk but the last one is full, so no chunk is left empty.
+                            const size_t chunkLength = (numElements + maxChunks - 1) / maxChunks;
+                            const size_t numChunks = (numElements + chunkLength - 1) / chunkLength;
+                            std::vector<size_t> chunkSizes(numChunks * residues);
+                            std::vector<size_t> chunkOffsets(numChunks);
+
+                            // Size of every chunk for each starting offset modulo the maximum alignment.
+                            parallelFor(pool, numChunks, [&](size_t chunk)
+                                    {
+                                        size_t first = chunk * chunkLength;
+                                        size_t last = first + chunkLength < numElements ? first + chunkLength : numElements;
+
+                                        for(size_t residue = 0; residue < residues; ++residue)
+                                        {
+                                            size_t offset = residue;
+
+                                            for(size_t count = first; count < last; ++count)
+                                                offset += getSerializedSize(vector_t[count], offset);
+
+                                            chunkSizes[chunk * residues + residue] = offset - residue;
+                                        }
+                                    });
+
+                            // Prefix sum of the chunk sizes, starting from the current offset.
+                            const size_t start = m_currentPosition - m_alignPosition;
+                            size_t offset = start;
+
+                            for(size_t chunk = 0; chunk < numChunks; ++chunk)
+                            {
+                                chunkOffsets[chunk] = offset;
+                                offset += chunkSizes[chunk * residues + offset % residues];
+                            }
+
+                            const size_t totalSize = offset - start;
+
+                            if(((m_lastPosition - m_currentPosition) < totalSize) && !resize(totalSize))
+                                throw eprosima::fastcdr::exception::NotEnoughMemoryException(eprosima::fastcdr::exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                            char *origin = &m_alignPosition;
+
+                            parallelFor(pool, numChunks, [&](size_t chunk)
+                                    {
+                                        size_t first = chunk * chunkLength;
+                                        size_t last = first + chunkLength < numElements ? first + chunkLength : numElements;
+                                        size_t residue = chunkOffsets[chunk] % residues;
+                                        size_t size = chunkSizes[chunk * residues + residue];
+
+                                        // The chunk buffer starts at an offset multiple of the maximum alignment,
+                                        // so alignment is computed as if it were the whole buffer.
+                                        FastBuffer chunkBuffer(origin + chunkOffsets[chunk] - residue, residue + size);
+                                        Cdr chunkCdr(chunkBuffer, (Endianness)m_endianness, m_cdrType);
+                                        inheritSettings(chunkCdr);
+                                        chunkCdr.jump(residue);
+
+                                        for(size_t count = first; count < last; ++count)
+                                            chunkCdr << vector_t[count];
+
+                                        if(chunkCdr.getSerializedDataLength() != residue + size)
+                                            throw eprosima::fastcdr::exception::BadParamException("Serialized size mismatch in Cdr::serializeParallel");
+                                    });
+
+                            m_currentPosition += totalSize;
+                            m_lastDataSize = 0;
+                        }
+                        catch(eprosima::fastcdr::exception::Exception &ex)
+                        {
+                            setState(state);
+                            ex.raise();
+                        }
+
+                        return *this;
+                    }
+
+                /*!
+                 * @brief This function template serializes a sequence using the threads of a pool.
+                 * The element sizes are obtained with the static function _T::getCdrSerializedSize(const _T&, size_t current_alignment).
+                 * @param vector_t The sequence that will be serialized in the buffer.
+                 * @param pool The thread pool used to compute the sizes and serialize the elements.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when getCdrSerializedSize does not match the serialized data.
+                 */
+                template<class _T>
+                    inline Cdr& serializeParallel(const std::vector<_T> &vector_t, ThreadPool &pool)
+                    {
+                        return serializeParallel(vector_t, pool, &_T::getCdrSerializedSize);
+                    }
+
                 /*!
                  * @brief This function deserializes an octet.
                  * @param octet_t The variable that will store the octet read from the buffer.
@@ -1722,6 +2413,108 @@ namespace eprosima
                         return *this;
                     }
 
+                /*!
+                 * @brief This function template deserializes a sequence using the threads of a pool.
+                 * A first sequential pass walks the sequence with the skip function to find where each chunk of elements starts.
+                 * Then the chunks are deserialized concurrently into the preallocated vector.
+                 * @param vector_t The variable that will store the sequence read from the buffer.
+                 * @param pool The thread pool used to deserialize the elements.
+                 * @param skip Function object called as skip(cdr). It has to move the eprosima::fastcdr::Cdr object over one element without decoding it.
+                 * @param minElementSize The minimum serialized size of an element, used to reject a wrong length before allocating the vector.
+                 * The default of one byte does not hold for empty structures; pass 0 for them, which disables the check.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the skip function does not match the deserialized data.
+                 */
+                template<class _T, class _SkipFunc>
+                    Cdr& deserializeParallel(std::vector<_T> &vector_t, ThreadPool &pool, _SkipFunc skip, size_t minElementSize = 1)
+                    {
+                        const size_t residues = 8;
+                        uint32_t seqLength = 0;
+                        state state(*this);
+
+                        *this >> seqLength;
+
+                        try
+                        {
+                            const size_t numElements = seqLength;
+                            const size_t maxChunks = getNumThreads(pool) * 4;
+
+                            // Every element takes at least minElementSize bytes, so a wrong length is detected before allocating the vector.
+                            if(minElementSize != 0 && numElements > (size_t)(m_lastPosition - m_currentPosition) / minElementSize)
+                                throw eprosima::fastcdr::exception::NotEnoughMemoryException(eprosima::fastcdr::exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                            vector_t.resize(numElements);
+
+                            if(numElements == 0)
+                                return *this;
+
+                            // Every chunk but the last one is full, so no chunk is left empty.
+                            const size_t chunkLength = (numElements + maxChunks - 1) / maxChunks;
+                            const size_t numChunks = (numElements + chunkLength - 1) / chunkLength;
+                            std::vector<size_t> chunkOffsets(numChunks + 1);
+
+                            // Boundary scan.
+                            for(size_t count = 0; count < numElements; ++count)
+                            {
+                                if(count % chunkLength == 0)
+                                    chunkOffsets[count / chunkLength] = m_currentPosition - m_alignPosition;
+
+                                skip(*this);
+                            }
+
+                            chunkOffsets[numChunks] = m_currentPosition - m_alignPosition;
+                            char *origin = &m_alignPosition;
+
+                            parallelFor(pool, numChunks, [&](size_t chunk)
+                                    {
+                                        size_t first = chunk * chunkLength;
+                                        size_t last = first + chunkLength < numElements ? first + chunkLength : numElements;
+                                        size_t residue = chunkOffsets[chunk] % residues;
+                                        size_t size = chunkOffsets[chunk + 1] - chunkOffsets[chunk];
+
+                                        // The chunk buffer starts at an offset multiple of the maximum alignment,
+                                        // so alignment is computed as if it were the whole buffer.
+                                        FastBuffer chunkBuffer(origin + chunkOffsets[chunk] - residue, residue + size);
+                                        Cdr chunkCdr(chunkBuffer, (Endianness)m_endianness, m_cdrType);
+                                        inheritSettings(chunkCdr);
+                                        chunkCdr.jump(residue);
+
+                                        for(size_t count = first; count < last; ++count)
+                                            chunkCdr >> vector_t[count];
+
+                                        if(chunkCdr.getSerializedDataLength() != residue + size)
+                                            throw eprosima::fastcdr::exception::BadParamException("Deserialized size mismatch in Cdr::deserializeParallel");
+                                    });
+
+                            m_lastDataSize = 0;
+                        }
+                        catch(eprosima::fastcdr::exception::Exception &ex)
+                        {
+                            setState(state);
+                            ex.raise();
+                        }
+
+                        return *this;
+                    }
+
+                /*!
+                 * @brief This function template deserializes a sequence using the threads of a pool.
+                 * The elements are skipped in the boundary scan with the static function _T::skip(eprosima::fastcdr::Cdr&).
+                 * Every element is assumed to take at least one byte. For empty structures call the overload with a skip function
+                 * and a minimum element size of 0.
+                 * @param vector_t The variable that will store the sequence read from the buffer.
+                 * @param pool The thread pool used to deserialize the elements.
+                 * @return Reference to the eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when _T::skip does not match the deserialized data.
+                 */
+                template<class _T>
+                    inline Cdr& deserializeParallel(std::vector<_T> &vector_t, ThreadPool &pool)
+                    {
+                        return deserializeParallel(vector_t, pool, &_T::skip);
+                    }
+
                 // TODO
                 template<class _T>
                     inline Cdr& deserialize(_T &type_t)
@@ -1985,6 +2778,7 @@ namespace eprosima
                  * @param numElements Number of the elements in the array.
                  * @return Reference to the eprosima::fastcdr::Cdr object.
                  * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when a byte is not 0 or 1.
                  */
                 Cdr& deserializeArray(bool *bool_t, size_t numElements);
 
@@ -2158,8 +2952,30 @@ namespace eprosima
 
                 Cdr& deserializeBoolSequence(std::vector<bool> &vector_t);
 
+                template<class _T>
+                    Cdr& serializeCompressed(const _T *value_t, size_t numElements);
+
+                template<class _T>
+                    Cdr& deserializeCompressed(_T *value_t, size_t numElements);
+
+                template<class _T>
+                    Cdr& serializeHalf(const _T *value_t, size_t numElements);
+
+                template<class _T>
+                    Cdr& deserializeHalf(_T *value_t, size_t numElements);
+
+                template<class _T>
+                    Cdr& serializeQuantized(const _T *value_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                template<class _T>
+                    Cdr& deserializeQuantized(_T *value_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
                 Cdr& deserializeStringSequence(std::string *&sequence_t, size_t &numElements);
 
+                void deserializeColumns(const size_t *sizes, size_t numMembers, void *const *columns, size_t numElements);
+
+                size_t getRecordLayout(size_t position, const size_t *sizes, size_t numMembers, size_t *offsets) const;
+
 #if HAVE_CXX0X
                 /*!
                  * @brief This function template detects the content type of the STD container array and serializes the array.
@@ -2221,7 +3037,13 @@ namespace eprosima
                  * @param dataSize The size of the data that will be serialized.
                  * @return The size needed for the aligment.
                  */
-                inline size_t alignment(size_t dataSize) const {return dataSize > m_lastDataSize ? (dataSize - ((m_currentPosition - m_alignPosition) % dataSize)) & (dataSize-1) : 0;}
+                inline size_t alignment(size_t dataSize) const
+                {
+                    if(dataSize > m_maxAlignment)
+                        dataSize = m_maxAlignment;
+
+                    return dataSize > m_lastDataSize ? (dataSize - ((m_currentPosition - m_alignPosition) % dataSize)) & (dataSize-1) : 0;
+                }
 
                 /*!
                  * @brief This function jumps the number of bytes of the alignment. These bytes should be calculated with the function eprosima::fastcdr::Cdr::alignment.
@@ -2229,6 +3051,9 @@ namespace eprosima
                  */
                 inline void makeAlign(size_t align){m_currentPosition += align;}
 
+                //! @brief Writes a 2 bytes length at a position of the stream.
+                void patchShortLength(size_t position, uint16_t length);
+
                 /*!
                  * @brief This function resizes the internal buffer. It only applies if the FastBuffer object was created with the default constructor.
                  * @param minSizeInc Minimun size increase for the internal buffer
@@ -2236,6 +3061,37 @@ namespace eprosima
                  */
                 bool resize(size_t minSizeInc);
 
+                /*!
+                 * @brief This function copies an array of primitive values using the threads of the parallel copy pool.
+                 * @param dst The destination of the copy.
+                 * @param src The source of the copy.
+                 * @param totalSize The number of bytes to be copied.
+                 * @param dataSize The size of each value. The bytes of every value are swapped if it is needed.
+                 */
+                void parallelCopy(char *dst, const char *src, size_t totalSize, size_t dataSize);
+
+                //! @brief Returns the number of threads of a pool. The pool is only declared in this header.
+                static size_t getNumThreads(const ThreadPool &pool);
+
+                //! @brief Runs task(context, index) for every index in [0, numTasks) using the threads of a pool.
+                static void runParallel(ThreadPool &pool, size_t numTasks, void (*task)(void*, size_t), void *context);
+
+                template<class _Task>
+                    static void invokeTask(void *context, size_t index) { (*static_cast<_Task*>(context))(index);}
+
+                //! @brief Runs a function object for every index in [0, numTasks) using the threads of a pool.
+                template<class _Task>
+                    static void parallelFor(ThreadPool &pool, size_t numTasks, _Task task) { runParallel(pool, numTasks, &invokeTask<_Task>, &task);}
+
+                /*!
+                 * @brief This function copies the serialization settings to a eprosima::fastcdr::Cdr object working on a region of the same stream.
+                 * @param cdr The eprosima::fastcdr::Cdr object that will serialize or deserialize the region.
+                 */
+                inline void inheritSettings(Cdr &cdr) const { cdr.m_swapBytes = m_swapBytes; cdr.m_encoding = m_encoding; cdr.m_maxAlignment = m_maxAlignment; }
+
+                //! @brief Writes a 4 bytes length at a position of the stream.
+                void patchLength(size_t position, uint32_t length);
+
                 //TODO
                 const char* readString(uint32_t &length);
 
@@ -2268,6 +3124,18 @@ namespace eprosima
 
                 //! @brief The last position in the buffer;
                 FastBuffer::iterator m_lastPosition;
+
+                //! @brief Thread pool used to copy large arrays. NULL if the parallel copy is disabled.
+                ThreadPool *m_threadPool;
+
+                //! @brief The minimum size in bytes of an array to be copied in parallel.
+                size_t m_parallelThreshold;
+
+                //! @brief The encoding algorithm of the encapsulation.
+                EncodingAlgorithmFlag m_encoding;
+
+                //! @brief The maximum alignment of the primitive types: 8 in XCDR1 and 4 in XCDR2.
+                size_t m_maxAlignment;
         };
     } //namespace fastcdr
 } //namespace eprosima
@@ -0,0 +1,177 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_CDRBATCH_H_
+#define _FASTCDR_CDRBATCH_H_
+
+#include "fastcdr_dll.h"
+#include "Cdr.h"
+#include "ThreadPool.h"
+#include "exceptions/BadParamException.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#define FASTCDR_PREFETCH(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+#define FASTCDR_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define FASTCDR_PREFETCH(address)
+#endif
+
+//! @brief Number of bytes of the next frame prefetched while the current one is deserialized.
+#define FASTCDR_BATCH_PREFETCH_BYTES 512
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers functions to serialize/deserialize many independent messages at once.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class CdrBatch
+        {
+            public:
+
+                //! @brief This enumeration represents the result of the processing of one message of a batch.
+                typedef enum
+                {
+                    //! @brief The message was processed.
+                    BATCH_OK,
+                    //! @brief The buffer was too small for the message.
+                    BATCH_NOT_ENOUGH_MEMORY,
+                    //! @brief The message contains an invalid value.
+                    BATCH_BAD_PARAM
+                } Status;
+
+                /*!
+                 * @brief This structure stores the result of the processing of one message of a batch.
+                 */
+                struct Result
+                {
+                    Result() : status(BATCH_OK), length(0) {}
+
+                    //! @brief Result of the processing.
+                    Status status;
+
+                    //! @brief Serialized length, or number of bytes read when deserializing.
+                    size_t length;
+                };
+
+                /*!
+                 * @brief This function template serializes each object into its own buffer using the threads of a pool.
+                 * Each object is a task of the pool, so a burst of messages of different sizes is balanced by work stealing.
+                 * @param objects Pointer to the objects that will be serialized.
+                 * @param buffers Pointer to the buffers. The object objects[i] is serialized into buffers[i].
+                 * @param count Number of objects.
+                 * @param pool The thread pool used to serialize the objects.
+                 * @param endianness The endianness used in the serialization.
+                 * @param cdrType The type of CDR used in the serialization. The encapsulation is serialized when it is eprosima::fastcdr::Cdr::DDS_CDR.
+                 * @return The result of each object, in the same order as the objects.
+                 */
+                template<class _T>
+                    static std::vector<Result> serialize(const _T *objects, FastBuffer *const *buffers, size_t count, ThreadPool &pool,
+                            Cdr::Endianness endianness = Cdr::DEFAULT_ENDIAN, Cdr::CdrType cdrType = Cdr::CORBA_CDR)
+                    {
+                        std::vector<Result> results(count);
+
+                        pool.parallelFor(count, [&](size_t index)
+                                {
+                                    Cdr cdr(*buffers[index], endianness, cdrType);
+
+                                    try
+                                    {
+                                        if(cdrType == Cdr::DDS_CDR)
+                                            cdr.serialize_encapsulation();
+
+                                        cdr << objects[index];
+                                        results[index].length = cdr.getSerializedDataLength();
+                                    }
+                                    catch(exception::NotEnoughMemoryException&)
+                                    {
+                                        results[index].status = BATCH_NOT_ENOUGH_MEMORY;
+                                    }
+                                    catch(exception::BadParamException&)
+                                    {
+                                        results[index].status = BATCH_BAD_PARAM;
+                                    }
+                                });
+
+                        return results;
+                    }
+
+                /*!
+                 * @brief This function template deserializes a batch of received frames.
+                 * A single eprosima::fastcdr::FastBuffer and eprosima::fastcdr::Cdr are reused for all the frames,
+                 * and the beginning of frame N+1 is prefetched while frame N is deserialized.
+                 * @param frames Pointer to the frames.
+                 * @param lengths Pointer to the lengths of the frames.
+                 * @param objects Pointer to the objects. The frame frames[i] is deserialized into objects[i].
+                 * @param count Number of frames.
+                 * @param endianness The endianness of the frames. It is overridden by the encapsulation when it is read.
+                 * @param cdrType The type of CDR of the frames. The encapsulation is read when it is eprosima::fastcdr::Cdr::DDS_CDR.
+                 * @return The result of each frame, in the same order as the frames.
+                 */
+                template<class _T>
+                    static std::vector<Result> deserialize(char *const *frames, const size_t *lengths, _T *objects, size_t count,
+                            Cdr::Endianness endianness = Cdr::DEFAULT_ENDIAN, Cdr::CdrType cdrType = Cdr::CORBA_CDR)
+                    {
+                        std::vector<Result> results(count);
+                        FastBuffer buffer(count > 0 ? frames[0] : NULL, count > 0 ? lengths[0] : 0);
+                        Cdr cdr(buffer, endianness, cdrType);
+
+                        for(size_t index = 0; index < count; ++index)
+                        {
+                            if(index + 1 < count)
+                            {
+                                size_t prefetch = lengths[index + 1] < FASTCDR_BATCH_PREFETCH_BYTES ? lengths[index + 1] : FASTCDR_BATCH_PREFETCH_BYTES;
+
+                                for(size_t offset = 0; offset < prefetch; offset += 64)
+                                    FASTCDR_PREFETCH(frames[index + 1] + offset);
+
+                                FASTCDR_PREFETCH(&objects[index + 1]);
+                            }
+
+                            buffer.setBuffer(frames[index], lengths[index]);
+                            cdr.changeEndianness(endianness);
+                            cdr.reset();
+                            // reset() keeps the encoding, so the XCDR2 settings of the previous frame are dropped here.
+                            cdr.setEncodingAlgorithm(Cdr::PLAIN_CDR);
+
+                            try
+                            {
+                                if(cdrType == Cdr::DDS_CDR)
+                                    cdr.read_encapsulation();
+
+                                cdr >> objects[index];
+                                results[index].length = cdr.getSerializedDataLength();
+                            }
+                            catch(exception::NotEnoughMemoryException&)
+                            {
+                                results[index].status = BATCH_NOT_ENOUGH_MEMORY;
+                            }
+                            catch(exception::BadParamException&)
+                            {
+                                results[index].status = BATCH_BAD_PARAM;
+                            }
+                        }
+
+                        return results;
+                    }
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_CDRBATCH_H_
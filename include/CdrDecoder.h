@@ -0,0 +1,301 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_CDRDECODER_H_
+#define _FASTCDR_CDRDECODER_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include "Cdr.h"
+#include <utility>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers the deserialization interface of eprosima::fastcdr::Cdr over a read-only eprosima::fastcdr::ConstFastBuffer.
+         * It has no serialization functions, so the stream is never written and it can be mapped without write permission.
+         * The deserialization functions, including the ones of the extended encodings, take the same arguments as the ones of eprosima::fastcdr::Cdr.
+         * The stream is read-only by interface only: user types are deserialized by their deserialize(eprosima::fastcdr::Cdr&) functions,
+         * which receive the underlying eprosima::fastcdr::Cdr object, so they must not call its serialization functions.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class CdrDecoder
+        {
+            public:
+
+                typedef Cdr::state state;
+
+                /*!
+                 * @brief This constructor creates an eprosima::fastcdr::CdrDecoder object that can deserialize the assigned buffer.
+                 *
+                 * @param cdrBuffer A reference to the buffer that contains the CDR representation.
+                 * @param endianness The initial endianness that will be used. The default value is the endianness of the system.
+                 * @param cdrType Represents the type of CDR that will be used in deserialization. The default value is CORBA CDR.
+                 */
+                CdrDecoder(const ConstFastBuffer &cdrBuffer, const Cdr::Endianness endianness = Cdr::DEFAULT_ENDIAN,
+                        const Cdr::CdrType cdrType = Cdr::CORBA_CDR) : m_cdr(cdrBuffer.m_buffer, endianness, cdrType) {}
+
+                /*!
+                 * @brief This function reads the encapsulation of the CDR stream.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when trying to deserialize an invalid value.
+                 */
+                inline CdrDecoder& read_encapsulation() { m_cdr.read_encapsulation(); return *this;}
+
+                /*!
+                 * @brief This function returns the parameter list flag when the CDR type is eprosima::fastcdr::DDS_CDR.
+                 * @return The flag that specifies if the content is a parameter list.
+                 */
+                inline Cdr::DDSCdrPlFlag getDDSCdrPlFlag() const { return m_cdr.getDDSCdrPlFlag();}
+
+                /*!
+                 * @brief This function returns the option flags when the CDR type is eprosima::fastcdr::DDS_CDR.
+                 * @return The option flags.
+                 */
+                inline uint16_t getDDSCdrOptions() const { return m_cdr.getDDSCdrOptions();}
+
+                /*!
+                 * @brief This function changes the endianness used to deserialize.
+                 * @param endianness The new endianness.
+                 */
+                inline void changeEndianness(Cdr::Endianness endianness) { m_cdr.changeEndianness(endianness);}
+
+                /*!
+                 * @brief This function returns the current endianness used by the CDR type.
+                 * @return The endianness.
+                 */
+                inline Cdr::Endianness endianness() { return m_cdr.endianness();}
+
+                /*!
+                 * @brief This function skips a number of bytes in the CDR stream buffer.
+                 * @param numBytes The number of bytes that will be jumped.
+                 * @return True is returned when it works successfully. Otherwise, false is returned.
+                 */
+                inline bool jump(size_t numBytes) { return m_cdr.jump(numBytes);}
+
+                /*!
+                 * @brief This function resets the current position in the buffer to the beginning.
+                 * It also picks up the stream set in the buffer with eprosima::fastcdr::ConstFastBuffer::setBuffer.
+                 */
+                inline void reset() { m_cdr.reset();}
+
+                /*!
+                 * @brief This function returns the pointer to the current used buffer.
+                 */
+                inline const char* getBufferPointer() { return m_cdr.getBufferPointer();}
+
+                /*!
+                 * @brief This function returns the current position in the CDR stream.
+                 * @return Pointer to the current position in the buffer.
+                 */
+                inline const char* getCurrentPosition() { return m_cdr.getCurrentPosition();}
+
+                /*!
+                 * @brief This function returns the number of bytes deserialized from the stream.
+                 * @return The length of the deserialized data.
+                 */
+                inline size_t getSerializedDataLength() const { return m_cdr.getSerializedDataLength();}
+
+                /*!
+                 * @brief This function returns the current state of the CDR deserialization process.
+                 * @return The current state of the CDR deserialization process.
+                 */
+                inline state getState() { return m_cdr.getState();}
+
+                /*!
+                 * @brief This function sets a previous state of the CDR deserialization process;
+                 * @param state Previous state that will be set.
+                 */
+                inline void setState(state &state) { m_cdr.setState(state);}
+
+                /*!
+                 * @brief This function moves the alignment forward.
+                 * @param numBytes The number of bytes the alignment should advance.
+                 * @return True If alignment was moved successfully.
+                 */
+                inline bool moveAlignmentForward(size_t numBytes) { return m_cdr.moveAlignmentForward(numBytes);}
+
+                /*!
+                 * @brief This function resets the alignment to the current position in the buffer.
+                 */
+                inline void resetAlignment() { m_cdr.resetAlignment();}
+
+                /*!
+                 * @brief This function enables the parallel copy of large arrays of primitive types.
+                 * @param pool The thread pool used for the copies, or NULL to disable them.
+                 * @param threshold The minimum size in bytes of an array to be copied in parallel.
+                 */
+                inline void setParallelCopy(ThreadPool *pool, size_t threshold = Cdr::DEFAULT_PARALLEL_THRESHOLD) { m_cdr.setParallelCopy(pool, threshold);}
+
+                /*!
+                 * @brief This operator template is used to deserialize any other non-basic type.
+                 * @param type_t A reference to the object that will be deserialized.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class _T>
+                    inline CdrDecoder& operator>>(_T &type_t) { m_cdr >> type_t; return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserialize.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserialize(_Args&&... args) { m_cdr.deserialize(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeArray.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeArray(_Args&&... args) { m_cdr.deserializeArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeSequence.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeSequence(_Args&&... args) { m_cdr.deserializeSequence(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeParallel.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeParallel(_Args&&... args) { m_cdr.deserializeParallel(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializePackedBoolArray.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializePackedBoolArray(_Args&&... args) { m_cdr.deserializePackedBoolArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializePackedBoolSequence.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializePackedBoolSequence(_Args&&... args) { m_cdr.deserializePackedBoolSequence(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeCompressedArray.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeCompressedArray(_Args&&... args) { m_cdr.deserializeCompressedArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeHalfArray.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeHalfArray(_Args&&... args) { m_cdr.deserializeHalfArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeQuantizedArray.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeQuantizedArray(_Args&&... args) { m_cdr.deserializeQuantizedArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeDictionaryString.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeDictionaryString(_Args&&... args) { m_cdr.deserializeDictionaryString(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeArrayView.
+                 * @return The value returned by eprosima::fastcdr::Cdr::deserializeArrayView.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline bool deserializeArrayView(_Args&&... args) { return m_cdr.deserializeArrayView(std::forward<_Args>(args)...);}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeSequenceColumns.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeSequenceColumns(_Args&&... args) { m_cdr.deserializeSequenceColumns(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeDHeader.
+                 * @return The value returned by eprosima::fastcdr::Cdr::deserializeDHeader.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline uint32_t deserializeDHeader(_Args&&... args) { return m_cdr.deserializeDHeader(std::forward<_Args>(args)...);}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::skipDelimited.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& skipDelimited(_Args&&... args) { m_cdr.skipDelimited(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeEMHeader.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeEMHeader(_Args&&... args) { m_cdr.deserializeEMHeader(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::skipMember.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& skipMember(_Args&&... args) { m_cdr.skipMember(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::Cdr::deserializeParameterHeader.
+                 * @return Reference to the eprosima::fastcdr::CdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline CdrDecoder& deserializeParameterHeader(_Args&&... args) { m_cdr.deserializeParameterHeader(std::forward<_Args>(args)...); return *this;}
+
+            private:
+
+                CdrDecoder(const CdrDecoder&) NON_COPYABLE_CXX11;
+
+                CdrDecoder& operator=(const CdrDecoder&) NON_COPYABLE_CXX11;
+
+                //! @brief The deserializer. Only its deserialization functions are reachable.
+                Cdr m_cdr;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_CDRDECODER_H_
@@ -0,0 +1,53 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_COLUMNTRANSPOSER_H_
+#define _FASTCDR_COLUMNTRANSPOSER_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class copies the members of an array of records into one contiguous array per member.
+         * Records of two, three or four members of 4 bytes without padding, like points of floats, are transposed
+         * four at a time with SSE2 shuffles when it is available. Other records are copied by blocks, member after member.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI ColumnTransposer
+        {
+            public:
+
+                /*!
+                 * @brief This function copies the members of an array of records into one array per member.
+                 * @param source The first record.
+                 * @param numRecords Number of the records.
+                 * @param stride The distance in bytes between consecutive records.
+                 * @param offsets The offsets of the members in the record.
+                 * @param sizes The sizes of the members: 1, 2, 4 or 8 bytes.
+                 * @param numMembers Number of the members.
+                 * @param columns The arrays that will store the members, one per member.
+                 * @param swapBytes Whether the bytes of each member have to be swapped.
+                 */
+                static void transpose(const char *source, size_t numRecords, size_t stride, const size_t *offsets, const size_t *sizes,
+                        size_t numMembers, void *const *columns, bool swapBytes);
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_COLUMNTRANSPOSER_H_
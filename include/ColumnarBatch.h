@@ -0,0 +1,579 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_COLUMNARBATCH_H_
+#define _FASTCDR_COLUMNARBATCH_H_
+
+#include "fastcdr_dll.h"
+#include "QuantizationCodec.h"
+#include "exceptions/BadParamException.h"
+#include "exceptions/NotEnoughMemoryException.h"
+#include <stdint.h>
+#include <cstddef>
+#include <string.h>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class describes the fields of a structure that are serialized as columns by eprosima::fastcdr::ColumnarBatch.
+         * Each field is a primitive value at an offset of the structure, usually given with offsetof.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI ColumnLayout
+        {
+            public:
+
+                /*!
+                 * @brief This enumeration represents the type of the values of a column.
+                 */
+                typedef enum
+                {
+                    COLUMN_CHAR = 1,
+                    COLUMN_OCTET = 2,
+                    COLUMN_SHORT = 3,
+                    COLUMN_USHORT = 4,
+                    COLUMN_LONG = 5,
+                    COLUMN_ULONG = 6,
+                    COLUMN_LONGLONG = 7,
+                    COLUMN_ULONGLONG = 8,
+                    COLUMN_FLOAT = 9,
+                    COLUMN_DOUBLE = 10,
+                    COLUMN_BOOLEAN = 11
+                } ColumnType;
+
+                /*!
+                 * @brief This enumeration represents the encoding of a column.
+                 */
+                typedef enum
+                {
+                    //! @brief The column is serialized as a plain array.
+                    CODEC_NONE = 0,
+                    //! @brief The column is serialized with eprosima::fastcdr::Cdr::serializeCompressedArray. Long, long long and floating point columns.
+                    CODEC_COMPRESSED = 1,
+                    //! @brief The column is serialized with eprosima::fastcdr::Cdr::serializeHalfArray. Floating point columns.
+                    CODEC_HALF = 2,
+                    //! @brief The column is serialized with eprosima::fastcdr::Cdr::serializeQuantizedArray and 8 bits codes. Floating point columns.
+                    CODEC_QUANTIZED_8_BITS = 3,
+                    //! @brief The column is serialized with eprosima::fastcdr::Cdr::serializeQuantizedArray and 16 bits codes. Floating point columns.
+                    CODEC_QUANTIZED_16_BITS = 4,
+                    //! @brief The column is serialized with eprosima::fastcdr::Cdr::serializePackedBoolArray. Boolean columns.
+                    CODEC_PACKED = 5
+                } Codec;
+
+                /*!
+                 * @brief This structure describes a column.
+                 */
+                struct Column
+                {
+                    //! @brief The offset of the field in the structure.
+                    size_t offset;
+
+                    //! @brief The type of the field.
+                    ColumnType type;
+
+                    //! @brief The encoding of the column.
+                    Codec codec;
+                };
+
+                /*!
+                 * @brief This constructor creates a layout without columns.
+                 * @param objectSize The size of the structure.
+                 */
+                ColumnLayout(size_t objectSize);
+
+                /*!
+                 * @brief This function adds a column.
+                 * @param offset The offset of the field in the structure.
+                 * @param type The type of the field.
+                 * @param codec The encoding of the column.
+                 * @return Reference to the eprosima::fastcdr::ColumnLayout object.
+                 * @exception exception::BadParamException This exception is thrown when the field is out of the structure or the codec does not support its type.
+                 */
+                ColumnLayout& addColumn(size_t offset, ColumnType type, Codec codec = CODEC_NONE);
+
+                /*!
+                 * @brief This function template adds a column with the type of the field given as template parameter.
+                 * @param offset The offset of the field in the structure.
+                 * @param codec The encoding of the column.
+                 * @return Reference to the eprosima::fastcdr::ColumnLayout object.
+                 * @exception exception::BadParamException This exception is thrown when the field is out of the structure or the codec does not support its type.
+                 */
+                template<class _F>
+                    inline ColumnLayout& addColumn(size_t offset, Codec codec = CODEC_NONE)
+                    {
+                        return addColumn(offset, getColumnType<_F>(), codec);
+                    }
+
+                /*!
+                 * @brief This function template returns the column type of a primitive type.
+                 * @return The column type.
+                 */
+                template<class _F>
+                    inline static ColumnType getColumnType() { return columnType(static_cast<const _F*>(NULL));}
+
+                /*!
+                 * @brief This function returns the size of the values of a column type.
+                 * @param type The column type.
+                 * @return The size in bytes.
+                 */
+                static size_t getElementSize(ColumnType type);
+
+                /*!
+                 * @brief This function returns the minimum number of bits that a value of a column takes once encoded with its codec.
+                 * It bounds the number of values that a buffer can contain.
+                 * @param column The column.
+                 * @return The minimum size in bits.
+                 */
+                static size_t getMinimumEncodedBits(const Column &column);
+
+                /*!
+                 * @brief This function returns the size of the structure.
+                 * @return The size in bytes.
+                 */
+                inline size_t getObjectSize() const { return m_objectSize;}
+
+                /*!
+                 * @brief This function returns the columns.
+                 * @return The columns, in serialization order.
+                 */
+                inline const std::vector<Column>& getColumns() const { return m_columns;}
+
+                /*!
+                 * @brief This function copies a field of each structure of an array into a contiguous array.
+                 * @param objects The array of structures.
+                 * @param numObjects Number of the structures.
+                 * @param column The index of the column.
+                 * @param array The array that will store the values of the field.
+                 */
+                void gather(const void *objects, size_t numObjects, size_t column, void *array) const;
+
+                /*!
+                 * @brief This function copies a contiguous array into a field of each structure of an array.
+                 * @param array The values of the field.
+                 * @param numObjects Number of the structures.
+                 * @param column The index of the column.
+                 * @param objects The array of structures.
+                 */
+                void scatter(const void *array, size_t numObjects, size_t column, void *objects) const;
+
+            private:
+
+                inline static ColumnType columnType(const char*) { return COLUMN_CHAR;}
+
+                inline static ColumnType columnType(const uint8_t*) { return COLUMN_OCTET;}
+
+                inline static ColumnType columnType(const int16_t*) { return COLUMN_SHORT;}
+
+                inline static ColumnType columnType(const uint16_t*) { return COLUMN_USHORT;}
+
+                inline static ColumnType columnType(const int32_t*) { return COLUMN_LONG;}
+
+                inline static ColumnType columnType(const uint32_t*) { return COLUMN_ULONG;}
+
+                inline static ColumnType columnType(const int64_t*) { return COLUMN_LONGLONG;}
+
+                inline static ColumnType columnType(const uint64_t*) { return COLUMN_ULONGLONG;}
+
+                inline static ColumnType columnType(const float*) { return COLUMN_FLOAT;}
+
+                inline static ColumnType columnType(const double*) { return COLUMN_DOUBLE;}
+
+                inline static ColumnType columnType(const bool*) { return COLUMN_BOOLEAN;}
+
+                //! @brief The size of the structure.
+                size_t m_objectSize;
+
+                //! @brief The columns.
+                std::vector<Column> m_columns;
+        };
+
+        /*!
+         * @brief This class serializes arrays of structures as columns: each field of the structures is stored as a contiguous array,
+         * which compresses better and can be consumed with SIMD instructions without rebuilding the structures.
+         * A batch is serialized as the number of structures, the number of columns and, for each column, its type, its codec and its array.
+         * When a batch is deserialized the plain columns are read in place whenever their bytes do not need to be converted
+         * and they are aligned in memory, and the others are decoded or copied into memory owned by this object. After an encapsulation
+         * the origin of the alignment is 4 bytes into the buffer, so the columns of 8 bytes values are copied. The columns can then be used directly or copied into structures.
+         * This encoding is an extension, not part of the CDR standard.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI ColumnarBatch
+        {
+            public:
+
+                ColumnarBatch();
+
+                /*!
+                 * @brief This function template serializes an array of structures as columns.
+                 * @param cdr The eprosima::fastcdr::Cdr or eprosima::fastcdr::FastCdr object.
+                 * @param layout The layout of the structures.
+                 * @param objects The array of structures.
+                 * @param numObjects Number of the structures.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the size of the structures does not match the layout,
+                 * or when there are more structures than a 32 bits count can hold.
+                 */
+                template<class _Cdr, class _T>
+                    static void serialize(_Cdr &cdr, const ColumnLayout &layout, const _T *objects, size_t numObjects)
+                    {
+                        if(sizeof(_T) != layout.getObjectSize())
+                            throw exception::BadParamException("Structure size does not match the column layout");
+
+                        if(numObjects > UINT32_MAX)
+                            throw exception::BadParamException("Too many structures for a column batch");
+
+                        const std::vector<ColumnLayout::Column> &columns = layout.getColumns();
+                        std::vector<uint64_t> array;
+                        typename _Cdr::state state(cdr);
+
+                        try
+                        {
+                            cdr.serialize(static_cast<uint32_t>(numObjects));
+                            cdr.serialize(static_cast<uint32_t>(columns.size()));
+
+                            for(size_t index = 0; index < columns.size(); ++index)
+                            {
+                                array.resize((numObjects * ColumnLayout::getElementSize(columns[index].type) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+                                layout.gather(objects, numObjects, index, array.data());
+
+                                cdr.serialize(static_cast<uint8_t>(columns[index].type));
+                                cdr.serialize(static_cast<uint8_t>(columns[index].codec));
+                                serializeColumn(cdr, columns[index], array.data(), numObjects);
+                            }
+                        }
+                        catch(exception::Exception &ex)
+                        {
+                            cdr.setState(state);
+                            ex.raise();
+                        }
+                    }
+
+                /*!
+                 * @brief This function template serializes a std::vector of structures as columns.
+                 * @param cdr The eprosima::fastcdr::Cdr or eprosima::fastcdr::FastCdr object.
+                 * @param layout The layout of the structures.
+                 * @param objects The structures.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the size of the structures does not match the layout.
+                 */
+                template<class _Cdr, class _T>
+                    inline static void serialize(_Cdr &cdr, const ColumnLayout &layout, const std::vector<_T> &objects)
+                    {
+                        serialize(cdr, layout, objects.data(), objects.size());
+                    }
+
+                /*!
+                 * @brief This function template deserializes a batch of columns. The previous columns of this object are discarded.
+                 * The columns read in place point to the buffer, so it has to outlive them.
+                 * @param cdr The eprosima::fastcdr::Cdr or eprosima::fastcdr::FastCdr object.
+                 * @param layout The layout of the structures. It has to outlive this object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the columns do not match the layout.
+                 */
+                template<class _Cdr>
+                    void deserialize(_Cdr &cdr, const ColumnLayout &layout)
+                    {
+                        const std::vector<ColumnLayout::Column> &columns = layout.getColumns();
+                        uint32_t numObjects = 0, numColumns = 0;
+                        typename _Cdr::state state(cdr);
+
+                        m_layout = NULL;
+                        m_numObjects = 0;
+                        m_columns.assign(columns.size(), NULL);
+                        m_storage.resize(columns.size());
+
+                        try
+                        {
+                            cdr.deserialize(numObjects);
+                            cdr.deserialize(numColumns);
+
+                            if(numColumns != columns.size())
+                                throw exception::BadParamException("Number of columns does not match the column layout");
+
+                            // The number of structures is checked against the buffer before any column is allocated.
+                            uint64_t minimumBits = 0;
+
+                            for(size_t index = 0; index < columns.size(); ++index)
+                                minimumBits += ColumnLayout::getMinimumEncodedBits(columns[index]);
+
+                            if(numObjects * minimumBits > (uint64_t)cdr.getRemainingDataLength() * 8)
+                                throw exception::NotEnoughMemoryException(exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                            for(size_t index = 0; index < columns.size(); ++index)
+                            {
+                                uint8_t type = 0, codec = 0;
+                                cdr.deserialize(type);
+                                cdr.deserialize(codec);
+
+                                if(type != columns[index].type || codec != columns[index].codec)
+                                    throw exception::BadParamException("Column does not match the column layout");
+
+                                deserializeColumn(cdr, index, columns[index], numObjects);
+                            }
+                        }
+                        catch(exception::Exception &ex)
+                        {
+                            cdr.setState(state);
+                            ex.raise();
+                        }
+
+                        m_layout = &layout;
+                        m_numObjects = numObjects;
+                    }
+
+                /*!
+                 * @brief This function returns the number of structures of the deserialized batch.
+                 * @return The number of structures.
+                 */
+                inline size_t getNumObjects() const { return m_numObjects;}
+
+                /*!
+                 * @brief This function template returns a column of the deserialized batch.
+                 * @param column The index of the column.
+                 * @return The contiguous array of values of the column.
+                 * @exception exception::BadParamException This exception is thrown when the column does not exist or it is not of the given type.
+                 */
+                template<class _F>
+                    const _F* getColumn(size_t column) const
+                    {
+                        checkColumn(column, ColumnLayout::getColumnType<_F>());
+                        return static_cast<const _F*>(m_columns[column]);
+                    }
+
+                /*!
+                 * @brief This function template copies the deserialized batch into an array of structures.
+                 * The fields not described by the layout are not modified.
+                 * @param objects The array that will store the structures. It has to have eprosima::fastcdr::ColumnarBatch::getNumObjects elements.
+                 * @exception exception::BadParamException This exception is thrown when the size of the structures does not match the layout.
+                 */
+                template<class _T>
+                    void getObjects(_T *objects) const
+                    {
+                        if(m_layout == NULL || sizeof(_T) != m_layout->getObjectSize())
+                            throw exception::BadParamException("Structure size does not match the column layout");
+
+                        for(size_t index = 0; index < m_columns.size(); ++index)
+                            m_layout->scatter(m_columns[index], m_numObjects, index, objects);
+                    }
+
+                /*!
+                 * @brief This function template copies the deserialized batch into a std::vector of structures, resizing it.
+                 * @param objects The std::vector that will store the structures.
+                 * @exception exception::BadParamException This exception is thrown when the size of the structures does not match the layout.
+                 */
+                template<class _T>
+                    inline void getObjects(std::vector<_T> &objects) const
+                    {
+                        objects.resize(m_numObjects);
+                        getObjects(objects.data());
+                    }
+
+            private:
+
+                ColumnarBatch(const ColumnarBatch&) NON_COPYABLE_CXX11;
+
+                ColumnarBatch& operator=(const ColumnarBatch&) NON_COPYABLE_CXX11;
+
+                void checkColumn(size_t column, ColumnLayout::ColumnType type) const;
+
+                //! @brief Returns memory owned by this object for a column.
+                void* allocateColumn(size_t column, size_t size);
+
+                template<class _Cdr, class _F>
+                    static void serializeArray(_Cdr &cdr, const _F *array, size_t numElements, ColumnLayout::Codec codec)
+                    {
+                        if(codec == ColumnLayout::CODEC_COMPRESSED)
+                            cdr.serializeCompressedArray(array, numElements);
+                        else
+                            cdr.serializeArray(array, numElements);
+                    }
+
+                template<class _Cdr, class _F>
+                    static void serializeRealArray(_Cdr &cdr, const _F *array, size_t numElements, ColumnLayout::Codec codec)
+                    {
+                        if(codec == ColumnLayout::CODEC_HALF)
+                            cdr.serializeHalfArray(array, numElements);
+                        else if(codec == ColumnLayout::CODEC_QUANTIZED_8_BITS)
+                            cdr.serializeQuantizedArray(array, numElements, QuantizationCodec::QUANTIZATION_8_BITS);
+                        else if(codec == ColumnLayout::CODEC_QUANTIZED_16_BITS)
+                            cdr.serializeQuantizedArray(array, numElements, QuantizationCodec::QUANTIZATION_16_BITS);
+                        else
+                            serializeArray(cdr, array, numElements, codec);
+                    }
+
+                template<class _Cdr>
+                    static void serializeColumn(_Cdr &cdr, const ColumnLayout::Column &column, const void *array, size_t numElements)
+                    {
+                        switch(column.type)
+                        {
+                            case ColumnLayout::COLUMN_CHAR:
+                                cdr.serializeArray(static_cast<const char*>(array), numElements);
+                                break;
+                            case ColumnLayout::COLUMN_OCTET:
+                                cdr.serializeArray(static_cast<const uint8_t*>(array), numElements);
+                                break;
+                            case ColumnLayout::COLUMN_SHORT:
+                                cdr.serializeArray(static_cast<const int16_t*>(array), numElements);
+                                break;
+                            case ColumnLayout::COLUMN_USHORT:
+                                cdr.serializeArray(static_cast<const uint16_t*>(array), numElements);
+                                break;
+                            case ColumnLayout::COLUMN_LONG:
+                                serializeArray(cdr, static_cast<const int32_t*>(array), numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_ULONG:
+                                serializeArray(cdr, static_cast<const uint32_t*>(array), numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_LONGLONG:
+                                serializeArray(cdr, static_cast<const int64_t*>(array), numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_ULONGLONG:
+                                serializeArray(cdr, static_cast<const uint64_t*>(array), numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_FLOAT:
+                                serializeRealArray(cdr, static_cast<const float*>(array), numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_DOUBLE:
+                                serializeRealArray(cdr, static_cast<const double*>(array), numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_BOOLEAN:
+                                if(column.codec == ColumnLayout::CODEC_PACKED)
+                                    cdr.serializePackedBoolArray(static_cast<const bool*>(array), numElements);
+                                else
+                                    cdr.serializeArray(static_cast<const bool*>(array), numElements);
+                                break;
+                        }
+                    }
+
+                // Reads a plain column in place when it is aligned, or copies it into owned memory.
+                template<class _Cdr, class _F>
+                    void deserializePlainArray(_Cdr &cdr, size_t index, size_t numElements)
+                    {
+                        const _F *view = NULL;
+
+                        if(cdr.deserializeArrayView(view, numElements))
+                        {
+                            if(reinterpret_cast<uintptr_t>(view) % sizeof(_F) == 0)
+                                m_columns[index] = view;
+                            else
+                                m_columns[index] = memcpy(allocateColumn(index, numElements * sizeof(_F)), view, numElements * sizeof(_F));
+                        }
+                        else
+                        {
+                            _F *array = static_cast<_F*>(allocateColumn(index, numElements * sizeof(_F)));
+                            cdr.deserializeArray(array, numElements);
+                            m_columns[index] = array;
+                        }
+                    }
+
+                template<class _Cdr, class _F>
+                    void deserializeArray(_Cdr &cdr, size_t index, size_t numElements, ColumnLayout::Codec codec)
+                    {
+                        if(codec == ColumnLayout::CODEC_COMPRESSED)
+                        {
+                            _F *array = static_cast<_F*>(allocateColumn(index, numElements * sizeof(_F)));
+                            cdr.deserializeCompressedArray(array, numElements);
+                            m_columns[index] = array;
+                        }
+                        else
+                            deserializePlainArray<_Cdr, _F>(cdr, index, numElements);
+                    }
+
+                template<class _Cdr, class _F>
+                    void deserializeRealArray(_Cdr &cdr, size_t index, size_t numElements, ColumnLayout::Codec codec)
+                    {
+                        if(codec == ColumnLayout::CODEC_HALF || codec == ColumnLayout::CODEC_QUANTIZED_8_BITS ||
+                                codec == ColumnLayout::CODEC_QUANTIZED_16_BITS)
+                        {
+                            _F *array = static_cast<_F*>(allocateColumn(index, numElements * sizeof(_F)));
+
+                            if(codec == ColumnLayout::CODEC_HALF)
+                                cdr.deserializeHalfArray(array, numElements);
+                            else
+                                cdr.deserializeQuantizedArray(array, numElements, codec == ColumnLayout::CODEC_QUANTIZED_8_BITS ?
+                                        QuantizationCodec::QUANTIZATION_8_BITS : QuantizationCodec::QUANTIZATION_16_BITS);
+
+                            m_columns[index] = array;
+                        }
+                        else
+                            deserializeArray<_Cdr, _F>(cdr, index, numElements, codec);
+                    }
+
+                template<class _Cdr>
+                    void deserializeColumn(_Cdr &cdr, size_t index, const ColumnLayout::Column &column, size_t numElements)
+                    {
+                        switch(column.type)
+                        {
+                            case ColumnLayout::COLUMN_CHAR:
+                                deserializePlainArray<_Cdr, char>(cdr, index, numElements);
+                                break;
+                            case ColumnLayout::COLUMN_OCTET:
+                                deserializePlainArray<_Cdr, uint8_t>(cdr, index, numElements);
+                                break;
+                            case ColumnLayout::COLUMN_SHORT:
+                                deserializePlainArray<_Cdr, int16_t>(cdr, index, numElements);
+                                break;
+                            case ColumnLayout::COLUMN_USHORT:
+                                deserializePlainArray<_Cdr, uint16_t>(cdr, index, numElements);
+                                break;
+                            case ColumnLayout::COLUMN_LONG:
+                                deserializeArray<_Cdr, int32_t>(cdr, index, numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_ULONG:
+                                deserializeArray<_Cdr, uint32_t>(cdr, index, numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_LONGLONG:
+                                deserializeArray<_Cdr, int64_t>(cdr, index, numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_ULONGLONG:
+                                deserializeArray<_Cdr, uint64_t>(cdr, index, numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_FLOAT:
+                                deserializeRealArray<_Cdr, float>(cdr, index, numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_DOUBLE:
+                                deserializeRealArray<_Cdr, double>(cdr, index, numElements, column.codec);
+                                break;
+                            case ColumnLayout::COLUMN_BOOLEAN:
+                                if(column.codec == ColumnLayout::CODEC_PACKED)
+                                {
+                                    bool *array = static_cast<bool*>(allocateColumn(index, numElements * sizeof(bool)));
+                                    cdr.deserializePackedBoolArray(array, numElements);
+                                    m_columns[index] = array;
+                                }
+                                else
+                                    deserializePlainArray<_Cdr, bool>(cdr, index, numElements);
+                                break;
+                        }
+                    }
+
+                //! @brief The layout of the deserialized batch.
+                const ColumnLayout *m_layout;
+
+                //! @brief Number of structures of the deserialized batch.
+                size_t m_numObjects;
+
+                //! @brief The columns of the deserialized batch, in the buffer or in m_storage.
+                std::vector<const void*> m_columns;
+
+                //! @brief Memory of the columns that are decoded or copied.
+                std::vector<std::vector<uint64_t> > m_storage;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_COLUMNARBATCH_H_
@@ -185,6 +185,9 @@ namespace eprosima
          * @brief This class represents a stream of bytes that contains (or will contain)
          * serialized data. This class is used by the serializers to serialize
          * or deserialize using their representation.
+         * The stream can reserve headroom before the origin of the serialized data and tailroom after it, so a transport
+         * can fill its headers and trailers in the same stream after serializing, without copying the serialized data.
+         * The serialized data is aligned relative to its origin, not to the beginning of the stream.
          * @ingroup FASTCDRAPIREFERENCE
          */
         class Cdr_DllAPI FastBuffer
@@ -208,6 +211,36 @@ namespace eprosima
                  */
                 FastBuffer(char* const buffer, const size_t bufferSize);
 
+                /*!
+                 * @brief This constructor assigns the user's stream of bytes to the eprosima::fastcdr::FastBuffers object,
+                 * reserving headroom at its beginning and tailroom at its end that are not used to serialize.
+                 *
+                 * @param buffer The user's buffer that will be used. This buffer is not deallocated in the object's destruction. Cannot be NULL.
+                 * @param bufferSize The length of user's buffer.
+                 * @param headroom The number of bytes reserved before the origin of the serialized data.
+                 * @param tailroom The number of bytes reserved after the serialized data.
+                 * @exception exception::BadParamException This exception is thrown when the headroom and the tailroom do not fit in the buffer.
+                 */
+                FastBuffer(char* const buffer, const size_t bufferSize, const size_t headroom, const size_t tailroom);
+
+#if HAVE_CXX0X
+                /*!
+                 * @brief Move constructor. The stream of bytes, and its ownership, is transferred from the other object,
+                 * which is left managing an empty internal stream.
+                 *
+                 * @param buffer eprosima::fastcdr::FastBuffer that will be moved.
+                 */
+                FastBuffer(FastBuffer &&buffer);
+
+                /*!
+                 * @brief Move assignment. The stream of bytes managed by this object is deallocated if it is internal,
+                 * and the stream of bytes of the other object, and its ownership, is transferred to this object.
+                 *
+                 * @param buffer eprosima::fastcdr::FastBuffer that will be moved.
+                 */
+                FastBuffer& operator=(FastBuffer &&buffer);
+#endif
+
                 /*!
                  * @brief Default destructor.
                  */
@@ -215,15 +248,54 @@ namespace eprosima
 
                 /*!
                  * @brief This function returns the stream that the eprosima::fastcdr::FastBuffers uses to serialize data.
-                 * @return The stream used by eprosima::fastcdr::FastBuffers to serialize data.
+                 * @return The stream used by eprosima::fastcdr::FastBuffers to serialize data. It points to the origin of the serialized data, after the headroom.
                  */
-                inline char* getBuffer() const { return m_buffer;}
+                inline char* getBuffer() const { return m_buffer + m_headroom;}
 
                 /*!
                  * @brief This function returns the size of the allocated memory of the stream that the eprosima::fastcdr::FastBuffers uses to serialize data.
-                 * @return The size of the allocated memory of the stream used by the eprosima::fastcdr::FastBuffers to serialize data.
+                 * @return The size of the allocated memory of the stream used by the eprosima::fastcdr::FastBuffers to serialize data, excluding the headroom and the tailroom.
+                 */
+                inline size_t getBufferSize() const { return m_buffer != NULL ? m_bufferSize - m_headroom - m_tailroom : 0;}
+
+                /*!
+                 * @brief This function returns the beginning of the whole stream, where the headroom starts.
+                 * The headers of the transport are written here.
+                 * @return The beginning of the whole stream.
+                 */
+                inline char* getPacket() const { return m_buffer;}
+
+                /*!
+                 * @brief This function returns the length of the packet formed by the headroom, the serialized data and the tailroom.
+                 * @param serializedLength The length of the serialized data.
+                 * @return The length of the packet.
+                 */
+                inline size_t getPacketLength(size_t serializedLength) const { return m_headroom + serializedLength + m_tailroom;}
+
+                /*!
+                 * @brief This function returns where the trailers of the transport are written: right after the serialized data.
+                 * @param serializedLength The length of the serialized data.
+                 * @return Pointer to the tailroom.
                  */
-                inline size_t getBufferSize() const { return m_bufferSize;}
+                inline char* getTrailer(size_t serializedLength) const { return m_buffer + m_headroom + serializedLength;}
+
+                /*!
+                 * @brief This function returns the number of bytes reserved before the origin of the serialized data.
+                 * @return The size of the headroom.
+                 */
+                inline size_t getHeadroom() const { return m_headroom;}
+
+                /*!
+                 * @brief This function returns the number of bytes reserved after the serialized data.
+                 * @return The size of the tailroom.
+                 */
+                inline size_t getTailroom() const { return m_tailroom;}
+
+                /*!
+                 * @brief This function returns if the stream is internal, that is, if it is deallocated in the object's destruction.
+                 * @return True if the stream is internal. False if it belongs to the user.
+                 */
+                inline bool isInternalBuffer() const { return m_internalBuffer;}
 
                 /*!
                  * @brief This function returns a iterator that points to the begining of the stream.
@@ -232,7 +304,7 @@ namespace eprosima
                 inline
                     iterator begin()
                     {
-                        return (iterator(m_buffer, 0));
+                        return (iterator(m_buffer + m_headroom, 0));
                     }
 
                 /*!
@@ -242,9 +314,52 @@ namespace eprosima
                 inline
                     iterator end()
                     {
-                        return (iterator(m_buffer, m_bufferSize));
+                        return (iterator(m_buffer + m_headroom, getBufferSize()));
                     }
 
+                /*!
+                 * @brief This function makes the eprosima::fastcdr::FastBuffer object use another user's stream of bytes.
+                 * If the object was managing an internal stream, it is deallocated.
+                 * The headroom and the tailroom are removed.
+                 * The eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using this buffer have to be reset after this call.
+                 *
+                 * @param buffer The user's buffer that will be used. This buffer is not deallocated in the object's destruction.
+                 * @param bufferSize The length of user's buffer.
+                 */
+                void setBuffer(char* const buffer, const size_t bufferSize);
+
+                /*!
+                 * @brief This function reserves headroom before the origin of the serialized data and tailroom after it.
+                 * The origin of the serialized data moves, so the eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects
+                 * using this buffer have to be reset after this call. The serialized data is not preserved.
+                 * An internal stream not allocated yet will be allocated with room for both.
+                 *
+                 * @param headroom The number of bytes reserved before the origin of the serialized data.
+                 * @param tailroom The number of bytes reserved after the serialized data.
+                 * @return True if the operation works. False if the headroom and the tailroom do not fit in an allocated stream.
+                 */
+                bool setRoom(size_t headroom, size_t tailroom);
+
+                /*!
+                 * @brief This function makes the eprosima::fastcdr::FastBuffer object take the ownership of a heap block.
+                 * The block becomes the internal stream: it can be resized and it is deallocated in the object's destruction.
+                 * If the object was managing an internal stream, it is deallocated. The headroom and the tailroom are removed.
+                 * The eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using this buffer have to be reset after this call.
+                 *
+                 * @param buffer The block that will be used. It has to be allocated with malloc() or realloc().
+                 * @param bufferSize The length of the block.
+                 */
+                void adopt(char* const buffer, const size_t bufferSize);
+
+                /*!
+                 * @brief This function gives up the ownership of the internal stream and returns it, including the headroom.
+                 * The caller becomes responsible of deallocating it with free(). After this call the object manages an empty internal stream,
+                 * so the eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using this buffer have to be reset.
+                 *
+                 * @return The internal stream, or NULL if the stream belongs to the user. In that case the object is not modified.
+                 */
+                char* release();
+
                 /*!
                  * @brief This function resizes the raw buffer. It will call the user's defined function for this purpose.
                  * @param minSizeInc The minimun growth expected of the current raw buffer.
@@ -252,17 +367,102 @@ namespace eprosima
                  */
                 bool resize(size_t minSizeInc);
 
+                /*!
+                 * @brief This function grows the internal stream so that at least the given number of bytes can be serialized without resizing.
+                 * The eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using this buffer have to be reset after this call if it moves the stream.
+                 * @param size The minimum size of the stream, excluding the headroom and the tailroom.
+                 * @return True if the stream is big enough after the operation. False if it is not, because the stream belongs to the user or cannot be allocated.
+                 */
+                bool reserve(size_t size);
+
+                /*!
+                 * @brief This function shrinks the internal stream to the given size, giving the rest of its memory back to the system.
+                 * The first size bytes are kept. A size of zero deallocates the stream; it will be allocated again when it is needed.
+                 * The eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using this buffer have to be reset after this call.
+                 * @param size The size of the stream after the operation, excluding the headroom and the tailroom.
+                 * @return True if the stream was shrunk or already was not bigger. False if the stream belongs to the user.
+                 */
+                bool shrink(size_t size);
+
             private:
 
+                FastBuffer(const FastBuffer&) NON_COPYABLE_CXX11;
+
+                FastBuffer& operator=(const FastBuffer&) NON_COPYABLE_CXX11;
+
                 //! @brief Pointer to the stream of bytes that contains the serialized data.
                 char *m_buffer;
 
                 //! @brief The total size of the user's buffer.
                 size_t m_bufferSize;
 
+                //! @brief The number of bytes reserved before the origin of the serialized data.
+                size_t m_headroom;
+
+                //! @brief The number of bytes reserved after the serialized data.
+                size_t m_tailroom;
+
                 //! @brief This variable indicates if the managed buffer is internal or is from the user.
                 bool m_internalBuffer;
         };
+
+        class CdrDecoder;
+        class FastCdrDecoder;
+
+        /*!
+         * @brief This class represents a read-only stream of bytes that contains serialized data.
+         * It is used by eprosima::fastcdr::CdrDecoder and eprosima::fastcdr::FastCdrDecoder to deserialize
+         * directly from const memory, like read-only mappings or shared memory segments, without copying it.
+         * The stream is never written nor resized.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class ConstFastBuffer
+        {
+            friend class CdrDecoder;
+            friend class FastCdrDecoder;
+
+            public:
+
+                /*!
+                 * @brief This constructor assigns the user's read-only stream of bytes to the eprosima::fastcdr::ConstFastBuffer object.
+                 *
+                 * @param buffer The user's buffer that will be used. This buffer is not deallocated in the object's destruction.
+                 * @param bufferSize The length of user's buffer.
+                 */
+                ConstFastBuffer(const char* const buffer, const size_t bufferSize) :
+                    m_buffer(const_cast<char*>(buffer), bufferSize) {}
+
+                /*!
+                 * @brief This function returns the stream that the eprosima::fastcdr::ConstFastBuffer uses to deserialize data.
+                 * @return The stream used to deserialize data.
+                 */
+                inline const char* getBuffer() const { return m_buffer.getBuffer();}
+
+                /*!
+                 * @brief This function returns the size of the stream that the eprosima::fastcdr::ConstFastBuffer uses to deserialize data.
+                 * @return The size of the stream.
+                 */
+                inline size_t getBufferSize() const { return m_buffer.getBufferSize();}
+
+                /*!
+                 * @brief This function makes the eprosima::fastcdr::ConstFastBuffer object use another read-only stream of bytes.
+                 * The decoders using this buffer have to be reset after this call.
+                 *
+                 * @param buffer The user's buffer that will be used.
+                 * @param bufferSize The length of user's buffer.
+                 */
+                inline void setBuffer(const char* const buffer, const size_t bufferSize) { m_buffer.setBuffer(const_cast<char*>(buffer), bufferSize);}
+
+            private:
+
+                ConstFastBuffer(const ConstFastBuffer&) NON_COPYABLE_CXX11;
+
+                ConstFastBuffer& operator=(const ConstFastBuffer&) NON_COPYABLE_CXX11;
+
+                //! @brief Stream wrapped for the decoders. Being a user's buffer, it is never resized, and the decoders only read from it,
+                //! so they can be created over a const eprosima::fastcdr::ConstFastBuffer object.
+                mutable FastBuffer m_buffer;
+        };
     } //namespace fastcdr
 } //namespace eprosima
 
@@ -17,10 +17,13 @@
 
 #include "fastcdr_dll.h"
 #include "FastBuffer.h"
+#include "QuantizationCodec.h"
+#include "StringDictionary.h"
 #include "exceptions/NotEnoughMemoryException.h"
 #include <stdint.h>
 #include <string>
 #include <vector>
+#include <type_traits>
 
 #if !__APPLE__
 #include <malloc.h>
@@ -78,6 +81,20 @@ namespace eprosima
                  */
                 FastCdr(FastBuffer &cdrBuffer);
 
+                /*!
+                 * @brief This function enables the compact mode, where the 32 and 64 bits integers, alone or in arrays,
+                 * are serialized as LEB128 variable length integers, zigzag encoded if they are signed.
+                 * Small values take one or two bytes instead of four or eight. Both sides have to use the same mode.
+                 * @param compact True to enable the compact mode.
+                 */
+                inline void setCompactIntegers(bool compact) { m_compactIntegers = compact;}
+
+                /*!
+                 * @brief This function returns if the compact mode is enabled.
+                 * @return True if the 32 and 64 bits integers are serialized as variable length integers.
+                 */
+                inline bool getCompactIntegers() const { return m_compactIntegers;}
+
                 /*!
                  * @brief This function skips a number of bytes in the CDR stream buffer.
                  * @param numBytes The number of bytes that will be jumped.
@@ -87,6 +104,7 @@ namespace eprosima
 
                 /*!
                  * @brief This function resets the current position in the buffer to the begining.
+                 * It also picks up the stream set in the buffer with eprosima::fastcdr::FastBuffer::setBuffer.
                  */
                 void reset();
 
@@ -102,6 +120,12 @@ namespace eprosima
                  */
                 inline size_t getSerializedDataLength() const { return m_currentPosition - m_cdrBuffer.begin();}
 
+                /*!
+                 * @brief This function returns the number of bytes between the current position and the end of the stream.
+                 * @return The length of the data left in the stream.
+                 */
+                inline size_t getRemainingDataLength() const { return m_lastPosition - m_currentPosition;}
+
                 /*!
                  * @brief This function returns the current state of the CDR stream.
                  * @return The current state of the buffer.
@@ -465,7 +489,7 @@ namespace eprosima
                 inline
                     FastCdr& serialize(const uint32_t ulong_t)
                     {
-                        return serialize((int32_t)ulong_t);
+                        return m_compactIntegers ? serializeVarUInt(ulong_t) : serialize((int32_t)ulong_t);
                     }
 
                 /*!
@@ -477,6 +501,9 @@ namespace eprosima
                 inline
                     FastCdr& serialize(const int32_t long_t)
                     {
+                        if(m_compactIntegers)
+                            return serializeVarInt(long_t);
+
                         if(((m_lastPosition - m_currentPosition) >= sizeof(long_t)) || resize(sizeof(long_t)))
                         {
                             m_currentPosition << long_t;
@@ -504,7 +531,7 @@ namespace eprosima
                 inline
                     FastCdr& serialize(const uint64_t ulonglong_t)
                     {
-                        return serialize((int64_t)ulonglong_t);
+                        return m_compactIntegers ? serializeVarUInt(ulonglong_t) : serialize((int64_t)ulonglong_t);
                     }
 
                 /*!
@@ -516,6 +543,9 @@ namespace eprosima
                 inline
                     FastCdr& serialize(const int64_t longlong_t)
                     {
+                        if(m_compactIntegers)
+                            return serializeVarInt(longlong_t);
+
                         if(((m_lastPosition - m_currentPosition) >= sizeof(longlong_t)) || resize(sizeof(longlong_t)))
                         {
                             m_currentPosition << longlong_t;
@@ -652,7 +682,7 @@ namespace eprosima
                     {
                         state state(*this);
 
-                        *this << (int32_t)vector_t.size();
+                        *this << (uint32_t)vector_t.size();
 
                         try
                         {
@@ -737,7 +767,7 @@ namespace eprosima
                 inline
                     FastCdr& serializeArray(const uint32_t *ulong_t, size_t numElements)
                     {
-                        return serializeArray((const int32_t*)ulong_t, numElements);
+                        return m_compactIntegers ? serializeVarintArray(ulong_t, numElements) : serializeArray((const int32_t*)ulong_t, numElements);
                     }
 
                 /*!
@@ -761,7 +791,7 @@ namespace eprosima
                 inline
                     FastCdr& serializeArray(const uint64_t *ulonglong_t, size_t numElements)
                     {
-                        return serializeArray((const int64_t*)ulonglong_t, numElements);
+                        return m_compactIntegers ? serializeVarintArray(ulonglong_t, numElements) : serializeArray((const int64_t*)ulonglong_t, numElements);
                     }
 
                 /*!
@@ -848,7 +878,7 @@ namespace eprosima
                     {
                         state state(*this);
 
-                        serialize((int32_t)numElements);
+                        serialize((uint32_t)numElements);
 
                         try
                         {
@@ -934,7 +964,7 @@ namespace eprosima
                 inline
                     FastCdr& deserialize(uint32_t &ulong_t)
                     {
-                        return deserialize((int32_t&)ulong_t);
+                        return m_compactIntegers ? deserializeVarintArray(&ulong_t, 1) : deserialize((int32_t&)ulong_t);
                     }
 
                 /*!
@@ -946,6 +976,9 @@ namespace eprosima
                 inline
                     FastCdr& deserialize(int32_t &long_t)
                     {
+                        if(m_compactIntegers)
+                            return deserializeVarintArray(&long_t, 1);
+
                         if((m_lastPosition - m_currentPosition) >= sizeof(long_t))
                         {
                             m_currentPosition >> long_t;
@@ -975,7 +1008,7 @@ namespace eprosima
                 inline
                     FastCdr& deserialize(uint64_t &ulonglong_t)
                     {
-                        return deserialize((int64_t&)ulonglong_t);
+                        return m_compactIntegers ? deserializeVarUInt(ulonglong_t) : deserialize((int64_t&)ulonglong_t);
                     }
 
                 /*!
@@ -987,6 +1020,9 @@ namespace eprosima
                 inline
                     FastCdr& deserialize(int64_t &longlong_t)
                     {
+                        if(m_compactIntegers)
+                            return deserializeVarInt(longlong_t);
+
                         if((m_lastPosition - m_currentPosition) >= sizeof(longlong_t))
                         {
                             m_currentPosition >> longlong_t;
@@ -1217,7 +1253,7 @@ namespace eprosima
                 inline
                     FastCdr& deserializeArray(uint32_t *ulong_t, size_t numElements)
                     {
-                        return deserializeArray((int32_t*)ulong_t, numElements);
+                        return m_compactIntegers ? deserializeVarintArray(ulong_t, numElements) : deserializeArray((int32_t*)ulong_t, numElements);
                     }
 
                 /*!
@@ -1241,7 +1277,7 @@ namespace eprosima
                 inline
                     FastCdr& deserializeArray(uint64_t *ulonglong_t, size_t numElements)
                     {
-                        return deserializeArray((int64_t*)ulonglong_t, numElements);
+                        return m_compactIntegers ? deserializeVarintArray(ulonglong_t, numElements) : deserializeArray((int64_t*)ulonglong_t, numElements);
                     }
 
                 /*!
@@ -1286,6 +1322,7 @@ namespace eprosima
                  * @param numElements Number of the elements in the array.
                  * @return Reference to the eprosima::fastcdr::FastCdr object.
                  * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when a byte is not 0 or 1.
                  */
                 FastCdr& deserializeArray(bool *bool_t, size_t numElements);
 
@@ -1366,6 +1403,426 @@ namespace eprosima
                     }
 #endif
 
+                /*!
+                 * @brief This function serializes an unsigned integer as a LEB128 variable length integer, whatever the mode.
+                 * @param value The value that will be serialized in the buffer.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeVarUInt(uint64_t value);
+
+                /*!
+                 * @brief This function serializes a signed integer as a zigzag encoded LEB128 variable length integer, whatever the mode.
+                 * @param value The value that will be serialized in the buffer.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeVarInt(int64_t value);
+
+                /*!
+                 * @brief This function deserializes an unsigned LEB128 variable length integer.
+                 * @param value The variable that will store the value read from the buffer.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the variable length integer is longer than 10 bytes.
+                 */
+                inline FastCdr& deserializeVarUInt(uint64_t &value) { return deserializeVarintArray(&value, 1);}
+
+                /*!
+                 * @brief This function deserializes a zigzag encoded LEB128 variable length integer.
+                 * @param value The variable that will store the value read from the buffer.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the variable length integer is longer than 10 bytes.
+                 */
+                inline FastCdr& deserializeVarInt(int64_t &value) { return deserializeVarintArray(&value, 1);}
+
+                /*!
+                 * @brief This function serializes an array of unsigned longs as LEB128 variable length integers, whatever the mode.
+                 * @param ulong_t The array of unsigned longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeVarintArray(const uint32_t *ulong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of longs as zigzag encoded LEB128 variable length integers, whatever the mode.
+                 * @param long_t The array of longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeVarintArray(const int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of unsigned long longs as LEB128 variable length integers, whatever the mode.
+                 * @param ulonglong_t The array of unsigned long longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeVarintArray(const uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of long longs as zigzag encoded LEB128 variable length integers, whatever the mode.
+                 * @param longlong_t The array of long longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeVarintArray(const int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of unsigned longs serialized as LEB128 variable length integers.
+                 * Eight bytes are decoded at once while the integers are short.
+                 * @param ulong_t The variable that will store the array of unsigned longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when a value does not fit in the type.
+                 */
+                FastCdr& deserializeVarintArray(uint32_t *ulong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of longs serialized as zigzag encoded LEB128 variable length integers.
+                 * Eight bytes are decoded at once while the integers are short.
+                 * @param long_t The variable that will store the array of longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when a value does not fit in the type.
+                 */
+                FastCdr& deserializeVarintArray(int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of unsigned long longs serialized as LEB128 variable length integers.
+                 * Eight bytes are decoded at once while the integers are short.
+                 * @param ulonglong_t The variable that will store the array of unsigned long longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when a variable length integer is longer than 10 bytes.
+                 */
+                FastCdr& deserializeVarintArray(uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of long longs serialized as zigzag encoded LEB128 variable length integers.
+                 * Eight bytes are decoded at once while the integers are short.
+                 * @param longlong_t The variable that will store the array of long longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when a variable length integer is longer than 10 bytes.
+                 */
+                FastCdr& deserializeVarintArray(int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of booleans packed eight per byte, the first boolean in the least significant bit.
+                 * @param bool_t The array of booleans that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializePackedBoolArray(const bool *bool_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of booleans packed eight per byte.
+                 * @param bool_t The variable that will store the array of booleans read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the unused bits of the last byte are not zero.
+                 */
+                FastCdr& deserializePackedBoolArray(bool *bool_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes a sequence of booleans packed eight per byte: the number of booleans followed by the packed array.
+                 * @param vector_t The sequence of booleans that will be serialized in the buffer.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializePackedBoolSequence(const std::vector<bool> &vector_t);
+
+                /*!
+                 * @brief This function deserializes a sequence of booleans packed eight per byte.
+                 * @param vector_t The variable that will store the sequence of booleans read from the buffer.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the unused bits of the last byte are not zero.
+                 */
+                FastCdr& deserializePackedBoolSequence(std::vector<bool> &vector_t);
+
+                /*!
+                 * @brief This function serializes an array of doubles compressed as each value XORed with the previous one: the size of the compressed array followed by it.
+                 * The values are restored exactly.
+                 * @param double_t The array of doubles that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeCompressedArray(const double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of floats compressed as each value XORed with the previous one: the size of the compressed array followed by it.
+                 * The values are restored exactly.
+                 * @param float_t The array of floats that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeCompressedArray(const float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of long longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * The values are restored exactly.
+                 * @param longlong_t The array of long longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeCompressedArray(const int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of unsigned long longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * The values are restored exactly.
+                 * @param ulonglong_t The array of unsigned long longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeCompressedArray(const uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * The values are restored exactly.
+                 * @param long_t The array of longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeCompressedArray(const int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of unsigned longs compressed as the difference between consecutive deltas of the values: the size of the compressed array followed by it.
+                 * The values are restored exactly.
+                 * @param ulong_t The array of unsigned longs that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeCompressedArray(const uint32_t *ulong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of doubles.
+                 * @param double_t The variable that will store the array of doubles read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                FastCdr& deserializeCompressedArray(double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of floats.
+                 * @param float_t The variable that will store the array of floats read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                FastCdr& deserializeCompressedArray(float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of long longs.
+                 * @param longlong_t The variable that will store the array of long longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                FastCdr& deserializeCompressedArray(int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of unsigned long longs.
+                 * @param ulonglong_t The variable that will store the array of unsigned long longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                FastCdr& deserializeCompressedArray(uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of longs.
+                 * @param long_t The variable that will store the array of longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                FastCdr& deserializeCompressedArray(int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes a compressed array of unsigned longs.
+                 * @param ulong_t The variable that will store the array of unsigned longs read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the compressed array is malformed.
+                 */
+                FastCdr& deserializeCompressedArray(uint32_t *ulong_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of floats as half precision values, two bytes each. The values are rounded to nearest even.
+                 * @param float_t The array of floats that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeHalfArray(const float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of doubles as half precision values, two bytes each. The values are rounded to nearest even.
+                 * @param double_t The array of doubles that will be serialized in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeHalfArray(const double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of floats serialized as half precision values.
+                 * @param float_t The variable that will store the array of floats read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& deserializeHalfArray(float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function deserializes an array of doubles serialized as half precision values.
+                 * @param double_t The variable that will store the array of doubles read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& deserializeHalfArray(double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function serializes an array of floats quantized over its range: the offset and the scale as floats followed by the codes.
+                 * @param float_t The array of floats that will be serialized in the buffer. The values that are not finite become the minimum.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeQuantizedArray(const float *float_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function serializes an array of doubles quantized over its range: the offset and the scale as floats followed by the codes.
+                 * @param double_t The array of doubles that will be serialized in the buffer. The values that are not finite become the minimum.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeQuantizedArray(const double *double_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function deserializes a quantized array of floats.
+                 * @param float_t The variable that will store the array of floats read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes, the same used to serialize the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& deserializeQuantizedArray(float *float_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function deserializes a quantized array of doubles.
+                 * @param double_t The variable that will store the array of doubles read from the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes, the same used to serialize the array.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& deserializeQuantizedArray(double *double_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                /*!
+                 * @brief This function serializes a string through the dictionary of a batch: a reference followed by the string the first time,
+                 * and only the reference after that.
+                 * The reference is a compact integer when the compact integer mode is enabled.
+                 * @param string_t The string that will be serialized in the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                FastCdr& serializeDictionaryString(const char *string_t, StringDictionary &dictionary);
+
+                /*!
+                 * @brief This function serializes a std::string through the dictionary of a batch.
+                 * @param string_t The string that will be serialized in the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+                 */
+                inline
+                    FastCdr& serializeDictionaryString(const std::string &string_t, StringDictionary &dictionary) {return serializeDictionaryString(string_t.c_str(), dictionary);}
+
+                /*!
+                 * @brief This function deserializes a string serialized through the dictionary of a batch, without copying it.
+                 * @param view_t The variable that will store the view of the string. It points to the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the reference is not in the dictionary.
+                 */
+                FastCdr& deserializeDictionaryString(StringDictionary::View &view_t, StringDictionary &dictionary);
+
+                /*!
+                 * @brief This function deserializes a std::string serialized through the dictionary of a batch.
+                 * @param string_t The variable that will store the string read from the buffer.
+                 * @param dictionary The dictionary of the batch.
+                 * @return Reference to the eprosima::fastcdr::FastCdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 * @exception exception::BadParamException This exception is thrown when the reference is not in the dictionary.
+                 */
+                inline
+                    FastCdr& deserializeDictionaryString(std::string &string_t, StringDictionary &dictionary)
+                    {
+                        StringDictionary::View view;
+                        deserializeDictionaryString(view, dictionary);
+                        string_t.assign(view.data, view.length);
+                        return *this;
+                    }
+
+                /*!
+                 * @brief This function template returns a pointer to an array of primitive values in the buffer instead of copying it.
+                 * The array is read as eprosima::fastcdr::FastCdr::deserializeArray would do. The pointer is not aligned.
+                 * @param array_t The variable that will store the pointer to the array in the buffer.
+                 * @param numElements Number of the elements in the array.
+                 * @return True if the array was read. False when it has to be copied, because it is an array of booleans
+                 * or of compact integers. In that case the position is not moved.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+                 */
+                template<class _T>
+                    bool deserializeArrayView(const _T *&array_t, size_t numElements)
+                    {
+                        if(std::is_same<_T, bool>::value || (m_compactIntegers && std::is_integral<_T>::value && sizeof(_T) >= sizeof(int32_t)))
+                            return false;
+
+                        size_t totalSize = sizeof(_T) * numElements;
+
+                        if((m_lastPosition - m_currentPosition) < totalSize)
+                            throw exception::NotEnoughMemoryException(exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+
+                        array_t = reinterpret_cast<const _T*>(&m_currentPosition);
+                        m_currentPosition += totalSize;
+
+                        return true;
+                    }
+
             private:
 
                 FastCdr(const FastCdr&) NON_COPYABLE_CXX11;
@@ -1376,6 +1833,24 @@ namespace eprosima
 
                 FastCdr& deserializeBoolSequence(std::vector<bool> &vector_t);
 
+                template<class _T>
+                    FastCdr& serializeCompressed(const _T *value_t, size_t numElements);
+
+                template<class _T>
+                    FastCdr& deserializeCompressed(_T *value_t, size_t numElements);
+
+                template<class _T>
+                    FastCdr& serializeHalf(const _T *value_t, size_t numElements);
+
+                template<class _T>
+                    FastCdr& deserializeHalf(_T *value_t, size_t numElements);
+
+                template<class _T>
+                    FastCdr& serializeQuantized(const _T *value_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
+                template<class _T>
+                    FastCdr& deserializeQuantized(_T *value_t, size_t numElements, QuantizationCodec::Quantization quantization);
+
                 FastCdr& deserializeStringSequence(std::string *&sequence_t, size_t &numElements);
 
 #if HAVE_CXX0X
@@ -1418,6 +1893,9 @@ namespace eprosima
 
                 //! @brief The last position in the buffer;
                 FastBuffer::iterator m_lastPosition;
+
+                //! @brief True when the 32 and 64 bits integers are serialized as variable length integers.
+                bool m_compactIntegers;
         };
     } //namespace fastcdr
 } //namespace eprosima
@@ -0,0 +1,222 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_FASTCDRDECODER_H_
+#define _FASTCDR_FASTCDRDECODER_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include "FastCdr.h"
+#include <utility>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers the deserialization interface of eprosima::fastcdr::FastCdr over a read-only eprosima::fastcdr::ConstFastBuffer.
+         * It has no serialization functions, so the stream is never written and it can be mapped without write permission.
+         * The deserialization functions, including the ones of the extended encodings, take the same arguments as the ones of eprosima::fastcdr::FastCdr.
+         * The stream is read-only by interface only: user types are deserialized by their deserialize(eprosima::fastcdr::FastCdr&) functions,
+         * which receive the underlying eprosima::fastcdr::FastCdr object, so they must not call its serialization functions.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class FastCdrDecoder
+        {
+            public:
+
+                typedef FastCdr::state state;
+
+                /*!
+                 * @brief This constructor creates a eprosima::fastcdr::FastCdrDecoder object that can deserialize the assigned buffer.
+                 *
+                 * @param cdrBuffer A reference to the buffer that contains the CDR representation.
+                 */
+                FastCdrDecoder(const ConstFastBuffer &cdrBuffer) : m_cdr(cdrBuffer.m_buffer) {}
+
+                /*!
+                 * @brief This function enables the compact mode. See eprosima::fastcdr::FastCdr::setCompactIntegers.
+                 * @param compact True if the integers were serialized as variable length integers.
+                 */
+                inline void setCompactIntegers(bool compact) { m_cdr.setCompactIntegers(compact);}
+
+                /*!
+                 * @brief This function returns if the compact mode is enabled.
+                 * @return True if the integers are deserialized as variable length integers.
+                 */
+                inline bool getCompactIntegers() const { return m_cdr.getCompactIntegers();}
+
+                /*!
+                 * @brief This function skips a number of bytes in the CDR stream buffer.
+                 * @param numBytes The number of bytes that will be jumped.
+                 * @return True is returned when the jump operation works successfully. Otherwise, false is returned.
+                 */
+                inline bool jump(size_t numBytes) { return m_cdr.jump(numBytes);}
+
+                /*!
+                 * @brief This function resets the current position in the buffer to the begining.
+                 * It also picks up the stream set in the buffer with eprosima::fastcdr::ConstFastBuffer::setBuffer.
+                 */
+                inline void reset() { m_cdr.reset();}
+
+                /*!
+                 * @brief This function returns the current position in the CDR stream.
+                 * @return Pointer to the current position in the buffer.
+                 */
+                inline const char* getCurrentPosition() { return m_cdr.getCurrentPosition();}
+
+                /*!
+                 * @brief This function returns the number of bytes deserialized from the stream.
+                 * @return The length of the deserialized data.
+                 */
+                inline size_t getSerializedDataLength() const { return m_cdr.getSerializedDataLength();}
+
+                /*!
+                 * @brief This function returns the current state of the CDR stream.
+                 * @return The current state of the buffer.
+                 */
+                inline state getState() { return m_cdr.getState();}
+
+                /*!
+                 * @brief This function sets a previous state of the CDR stream;
+                 * @param state Previous state that will be set again.
+                 */
+                inline void setState(state &state) { m_cdr.setState(state);}
+
+                /*!
+                 * @brief This operator template is used to deserialize any other non-basic type.
+                 * @param type_t A reference to the object that will be deserialized.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class _T>
+                    inline FastCdrDecoder& operator>>(_T &type_t) { m_cdr >> type_t; return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserialize.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserialize(_Args&&... args) { m_cdr.deserialize(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeArray.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeArray(_Args&&... args) { m_cdr.deserializeArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeSequence.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeSequence(_Args&&... args) { m_cdr.deserializeSequence(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializePackedBoolArray.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializePackedBoolArray(_Args&&... args) { m_cdr.deserializePackedBoolArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializePackedBoolSequence.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializePackedBoolSequence(_Args&&... args) { m_cdr.deserializePackedBoolSequence(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeCompressedArray.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeCompressedArray(_Args&&... args) { m_cdr.deserializeCompressedArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeHalfArray.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeHalfArray(_Args&&... args) { m_cdr.deserializeHalfArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeQuantizedArray.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeQuantizedArray(_Args&&... args) { m_cdr.deserializeQuantizedArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeDictionaryString.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeDictionaryString(_Args&&... args) { m_cdr.deserializeDictionaryString(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeArrayView.
+                 * @return The value returned by eprosima::fastcdr::FastCdr::deserializeArrayView.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline bool deserializeArrayView(_Args&&... args) { return m_cdr.deserializeArrayView(std::forward<_Args>(args)...);}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeVarintArray.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeVarintArray(_Args&&... args) { m_cdr.deserializeVarintArray(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeVarUInt.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeVarUInt(_Args&&... args) { m_cdr.deserializeVarUInt(std::forward<_Args>(args)...); return *this;}
+
+                /*!
+                 * @brief This function template forwards to eprosima::fastcdr::FastCdr::deserializeVarInt.
+                 * @return Reference to the eprosima::fastcdr::FastCdrDecoder object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class... _Args>
+                    inline FastCdrDecoder& deserializeVarInt(_Args&&... args) { m_cdr.deserializeVarInt(std::forward<_Args>(args)...); return *this;}
+
+            private:
+
+                FastCdrDecoder(const FastCdrDecoder&) NON_COPYABLE_CXX11;
+
+                FastCdrDecoder& operator=(const FastCdrDecoder&) NON_COPYABLE_CXX11;
+
+                //! @brief The deserializer. Only its deserialization functions are reachable.
+                FastCdr m_cdr;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_FASTCDRDECODER_H_
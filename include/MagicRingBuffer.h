@@ -0,0 +1,125 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_MAGICRINGBUFFER_H_
+#define _FASTCDR_MAGICRINGBUFFER_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include <stdint.h>
+#include <cstddef>
+#include <atomic>
+
+#if !defined(_WIN32)
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class implements a circular byte buffer whose memory is mapped twice consecutively.
+         * Any region of up to the capacity starting anywhere in the ring is contiguous in the virtual address space,
+         * so every reservation can be handed to eprosima::fastcdr::Cdr or eprosima::fastcdr::FastCdr as a plain
+         * eprosima::fastcdr::FastBuffer and frames are never split at the wrap point.
+         * One writer and one reader can use the ring concurrently.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI MagicRingBuffer
+        {
+            public:
+
+                /*!
+                 * @brief This constructor maps the ring.
+                 * @param capacity The minimum capacity of the ring. It is rounded up to a multiple of the page size.
+                 * @exception exception::BadParamException This exception is thrown when the capacity is zero.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the ring cannot be mapped.
+                 */
+                explicit MagicRingBuffer(size_t capacity);
+
+                /*!
+                 * @brief Default destructor. The ring is unmapped.
+                 */
+                virtual ~MagicRingBuffer();
+
+                /*!
+                 * @brief This function returns a contiguous writable region at the write position of the ring.
+                 * The returned eprosima::fastcdr::FastBuffer does not own its memory and cannot grow.
+                 * @param size The size of the region.
+                 * @return A eprosima::fastcdr::FastBuffer over the reserved region.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when there is not enough free space in the ring.
+                 */
+                FastBuffer reserve(size_t size);
+
+                /*!
+                 * @brief This function makes the first bytes of the last reservation visible to the reader.
+                 * @param length Number of bytes written in the reservation.
+                 * @exception exception::BadParamException This exception is thrown when the length exceeds the free space of the ring.
+                 */
+                void commit(size_t length);
+
+                /*!
+                 * @brief This function returns a contiguous region with all the committed bytes not consumed yet.
+                 * @return A eprosima::fastcdr::FastBuffer over the readable region.
+                 */
+                FastBuffer peek();
+
+                /*!
+                 * @brief This function releases bytes at the read position of the ring.
+                 * @param length Number of bytes that will be released.
+                 * @exception exception::BadParamException This exception is thrown when the length exceeds the readable bytes.
+                 */
+                void consume(size_t length);
+
+                /*!
+                 * @brief This function returns the number of committed bytes not consumed yet.
+                 * @return The number of readable bytes.
+                 */
+                size_t getReadableSize() const;
+
+                /*!
+                 * @brief This function returns the number of bytes that can be reserved.
+                 * @return The number of free bytes.
+                 */
+                size_t getFreeSize() const;
+
+                /*!
+                 * @brief This function returns the capacity of the ring.
+                 * @return The capacity of the ring in bytes.
+                 */
+                inline size_t getCapacity() const { return m_capacity; }
+
+            private:
+
+                MagicRingBuffer(const MagicRingBuffer&) NON_COPYABLE_CXX11;
+
+                MagicRingBuffer& operator=(const MagicRingBuffer&) NON_COPYABLE_CXX11;
+
+                //! @brief Start of the first mapping. The second mapping starts at m_buffer + m_capacity.
+                char *m_buffer;
+
+                //! @brief The size of each mapping.
+                size_t m_capacity;
+
+                //! @brief Total bytes committed since the creation. Only modified by the writer.
+                std::atomic<uint64_t> m_writeIndex;
+
+                //! @brief Total bytes consumed since the creation. Only modified by the reader.
+                std::atomic<uint64_t> m_readIndex;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // !_WIN32
+
+#endif // _FASTCDR_MAGICRINGBUFFER_H_
@@ -0,0 +1,179 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_NUMABUFFERPOOL_H_
+#define _FASTCDR_NUMABUFFERPOOL_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+#include <unordered_set>
+#include <mutex>
+#include <atomic>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class implements a pool of serialization buffers kept per NUMA node.
+         * A buffer can be requested local to the node of the thread that will consume it, so the consumer does not read
+         * memory of another socket. Blocks are mapped with mmap(), so their pages belong to no other allocation, and they are bound
+         * to their node with mbind() when the system supports it; otherwise they are placed by first touch in the thread that allocates them.
+         * On systems without NUMA support the pool behaves as a single node pool.
+         * The pool owns its blocks and lends them to eprosima::fastcdr::FastBuffer objects as user streams, so they cannot grow beyond
+         * the block size. The pool has to outlive the buffers using its blocks. A block must never be adopted by a buffer with
+         * eprosima::fastcdr::FastBuffer::adopt, because the buffer would deallocate with free() memory mapped with mmap().
+         * The pool can be used from several threads.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI NumaBufferPool
+        {
+            public:
+
+                /*!
+                 * @brief This structure stores the statistics of a pool.
+                 */
+                struct Statistics
+                {
+                    //! @brief Number of blocks allocated from the system.
+                    uint64_t allocations;
+
+                    //! @brief Number of buffers served from the free lists.
+                    uint64_t reuses;
+
+                    //! @brief Number of buffers given back by a thread running on the node of their memory.
+                    uint64_t localHandoffs;
+
+                    //! @brief Number of buffers given back by a thread running on another node.
+                    uint64_t remoteHandoffs;
+                };
+
+                /*!
+                 * @brief This constructor creates an empty pool.
+                 * @param blockSize The size of the blocks of the pool.
+                 * @param maxBlocksPerNode Maximum number of free blocks kept for each node. Extra blocks are deallocated.
+                 * @exception exception::BadParamException This exception is thrown when the block size is zero.
+                 */
+                explicit NumaBufferPool(size_t blockSize, size_t maxBlocksPerNode = 64);
+
+                /*!
+                 * @brief Default destructor. All the blocks are unmapped, including the ones still lent to buffers.
+                 */
+                virtual ~NumaBufferPool();
+
+                /*!
+                 * @brief This function returns the number of NUMA nodes of the system.
+                 * @return The number of nodes. It is 1 when the system has no NUMA support.
+                 */
+                static unsigned getNumNodes();
+
+                /*!
+                 * @brief This function returns the NUMA node where the calling thread is running.
+                 * @return The node of the calling thread. It is 0 when the system has no NUMA support.
+                 */
+                static unsigned getCurrentNode();
+
+                /*!
+                 * @brief This function returns the NUMA node where a memory address is placed.
+                 * @param address The memory address. Its page has to be already touched.
+                 * @return The node of the memory. It is 0 when the system has no NUMA support.
+                 */
+                static unsigned getNodeOfAddress(const void *address);
+
+                /*!
+                 * @brief This function lends a eprosima::fastcdr::FastBuffer a block placed on the given node.
+                 * If the buffer was using a block of this pool, the block is given back first.
+                 * If the buffer was managing an internal stream, it is deallocated.
+                 * @param buffer The eprosima::fastcdr::FastBuffer that will use the block.
+                 * @param node The node where the block has to be placed, usually the node of the thread that will consume it.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the block cannot be allocated.
+                 */
+                void acquire(FastBuffer &buffer, unsigned node);
+
+                /*!
+                 * @brief This function lends a eprosima::fastcdr::FastBuffer a block placed on the node of the calling thread.
+                 * @param buffer The eprosima::fastcdr::FastBuffer that will use the block.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the block cannot be allocated.
+                 */
+                inline void acquire(FastBuffer &buffer) { acquire(buffer, getCurrentNode());}
+
+                /*!
+                 * @brief This function takes back the block lent to a eprosima::fastcdr::FastBuffer.
+                 * It is accounted as a local or a remote hand-off comparing the node of the block with the node of the calling thread,
+                 * and it is kept in the free list of the node of its memory, or unmapped if the list is full.
+                 * Nothing is done if the stream of the buffer is not a block of this pool.
+                 * @param buffer The eprosima::fastcdr::FastBuffer whose block is given back. It is left empty.
+                 */
+                void release(FastBuffer &buffer);
+
+                /*!
+                 * @brief This function returns the size of the blocks of the pool.
+                 * @return The size of the blocks.
+                 */
+                inline size_t getBlockSize() const { return m_blockSize;}
+
+                /*!
+                 * @brief This function returns the statistics of the pool.
+                 * @return A copy of the current statistics.
+                 */
+                Statistics getStatistics() const;
+
+            private:
+
+                NumaBufferPool(const NumaBufferPool&) NON_COPYABLE_CXX11;
+
+                NumaBufferPool& operator=(const NumaBufferPool&) NON_COPYABLE_CXX11;
+
+                //! @brief Free blocks of one node.
+                struct alignas(64) NodePool
+                {
+                    std::mutex mutex;
+                    std::vector<char*> blocks;
+                };
+
+                //! @brief Maps a block bound to a node, touches its pages and registers it.
+                char* allocateBlock(unsigned node);
+
+                //! @brief Unregisters and unmaps a block.
+                void freeBlock(char *block);
+
+                //! @brief Size of the blocks.
+                size_t m_blockSize;
+
+                //! @brief Maximum number of free blocks kept for each node.
+                size_t m_maxBlocksPerNode;
+
+                //! @brief Free blocks, indexed by node.
+                std::vector<NodePool> m_nodes;
+
+                std::mutex m_blocksMutex;
+
+                //! @brief All the blocks mapped by the pool, free or lent.
+                std::unordered_set<char*> m_blocks;
+
+                std::atomic<uint64_t> m_allocations;
+
+                std::atomic<uint64_t> m_reuses;
+
+                std::atomic<uint64_t> m_localHandoffs;
+
+                std::atomic<uint64_t> m_remoteHandoffs;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_NUMABUFFERPOOL_H_
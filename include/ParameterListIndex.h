@@ -0,0 +1,119 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_PARAMETERLISTINDEX_H_
+#define _FASTCDR_PARAMETERLISTINDEX_H_
+
+#include "fastcdr_dll.h"
+#include "Cdr.h"
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class indexes the parameters of a parameter list by their identifier.
+         * The list is walked once, jumping over the parameter values, and the parameters are then found by a binary search,
+         * so a message with many parameters can be queried without scanning it again or deserializing it completely.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI ParameterListIndex
+        {
+            public:
+
+                /*!
+                 * @brief This structure stores the location of a parameter value in the stream.
+                 */
+                struct Entry
+                {
+                    //! @brief The parameter identifier, including its flags.
+                    uint32_t pid;
+
+                    //! @brief The position of the value from the beginning of the stream.
+                    size_t offset;
+
+                    //! @brief The length of the value.
+                    uint32_t length;
+                };
+
+                ParameterListIndex();
+
+                /*!
+                 * @brief This function indexes the parameter list starting at the current position of a eprosima::fastcdr::Cdr object.
+                 * The list ends with the DDS-XTypes sentinel eprosima::fastcdr::Cdr::PID_SENTINEL, whatever its flags.
+                 * After it, the eprosima::fastcdr::Cdr object is after the sentinel of the list.
+                 * @param cdr The eprosima::fastcdr::Cdr object.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the list exceeds the internal memory size or it has no sentinel.
+                 */
+                void build(Cdr &cdr);
+
+                /*!
+                 * @brief This function returns the first parameter with the given identifier.
+                 * @param pid The parameter identifier, including its flags.
+                 * @return The entry of the parameter, or NULL if the list does not contain it.
+                 */
+                const Entry* find(uint32_t pid) const;
+
+                /*!
+                 * @brief This function returns the number of parameters with the given identifier.
+                 * @param pid The parameter identifier, including its flags.
+                 * @return The number of parameters.
+                 */
+                size_t count(uint32_t pid) const;
+
+                /*!
+                 * @brief This function moves a eprosima::fastcdr::Cdr object to the value of the first parameter with the given identifier.
+                 * The alignment is reset to the beginning of the value.
+                 * @param cdr The eprosima::fastcdr::Cdr object over the indexed stream.
+                 * @param pid The parameter identifier, including its flags.
+                 * @return True if the list contains the parameter. False otherwise, and the eprosima::fastcdr::Cdr object is not moved.
+                 */
+                bool seek(Cdr &cdr, uint32_t pid) const;
+
+                /*!
+                 * @brief This function template deserializes the value of the first parameter with the given identifier.
+                 * @param cdr The eprosima::fastcdr::Cdr object over the indexed stream.
+                 * @param pid The parameter identifier, including its flags.
+                 * @param value The variable that will store the value.
+                 * @return True if the list contains the parameter. False otherwise.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+                 */
+                template<class _T>
+                    bool deserialize(Cdr &cdr, uint32_t pid, _T &value) const
+                    {
+                        if(!seek(cdr, pid))
+                            return false;
+
+                        cdr >> value;
+                        return true;
+                    }
+
+                /*!
+                 * @brief This function returns all the parameters, sorted by identifier. Parameters with the same identifier keep the order of the list.
+                 * @return The entries of the parameters.
+                 */
+                inline const std::vector<Entry>& getEntries() const { return m_entries;}
+
+            private:
+
+                //! @brief Parameters sorted by identifier.
+                std::vector<Entry> m_entries;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_PARAMETERLISTINDEX_H_
@@ -0,0 +1,192 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_QUANTIZATIONCODEC_H_
+#define _FASTCDR_QUANTIZATIONCODEC_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers lossy codecs for arrays of floating point values.
+         * The values can be converted to IEEE 754 half precision, with F16C instructions when the library is built with them enabled
+         * (for instance with -mf16c; there is no runtime dispatch, so otherwise the portable conversion is used),
+         * or quantized to 8 or 16 bits codes over the range of the array: the code q stands for offset + q * scale.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI QuantizationCodec
+        {
+            public:
+
+                /*!
+                 * @brief This enumeration represents the size of the codes of a quantized array.
+                 */
+                typedef enum
+                {
+                    //! @brief 8 bits codes, 256 levels.
+                    QUANTIZATION_8_BITS = 1,
+                    //! @brief 16 bits codes, 65536 levels.
+                    QUANTIZATION_16_BITS = 2
+                } Quantization;
+
+                /*!
+                 * @brief This function converts an array of floats to half precision, rounding to nearest even.
+                 * Values out of the half precision range become infinities.
+                 * @param float_t The array of floats.
+                 * @param numElements Number of the elements in the array.
+                 * @param half_t The array that will store the half precision values.
+                 */
+                static void toHalf(const float *float_t, size_t numElements, uint16_t *half_t);
+
+                /*!
+                 * @brief This function converts an array of doubles to half precision. The doubles are rounded to float first.
+                 * @param double_t The array of doubles.
+                 * @param numElements Number of the elements in the array.
+                 * @param half_t The array that will store the half precision values.
+                 */
+                static void toHalf(const double *double_t, size_t numElements, uint16_t *half_t);
+
+                /*!
+                 * @brief This function converts an array of half precision values to floats. The conversion is exact.
+                 * @param half_t The array of half precision values.
+                 * @param numElements Number of the elements in the array.
+                 * @param float_t The array that will store the floats.
+                 */
+                static void fromHalf(const uint16_t *half_t, size_t numElements, float *float_t);
+
+                /*!
+                 * @brief This function converts an array of half precision values to doubles. The conversion is exact.
+                 * @param half_t The array of half precision values.
+                 * @param numElements Number of the elements in the array.
+                 * @param double_t The array that will store the doubles.
+                 */
+                static void fromHalf(const uint16_t *half_t, size_t numElements, double *double_t);
+
+                /*!
+                 * @brief This function computes the offset and the scale that quantize an array over its range.
+                 * Values that are not finite are ignored.
+                 * @param float_t The array of floats.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 */
+                static void getRange(const float *float_t, size_t numElements, Quantization quantization, float &offset, float &scale);
+
+                /*!
+                 * @brief This function computes the offset and the scale that quantize an array over its range.
+                 * Values that are not finite are ignored and values beyond the float range are clamped to it.
+                 * @param double_t The array of doubles.
+                 * @param numElements Number of the elements in the array.
+                 * @param quantization The size of the codes.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 */
+                static void getRange(const double *double_t, size_t numElements, Quantization quantization, float &offset, float &scale);
+
+                /*!
+                 * @brief This function quantizes an array of floats to 8 bits codes, rounding to the nearest code.
+                 * Values out of the range are clamped and NaN becomes the code 0.
+                 * @param float_t The array of floats.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param code_t The array that will store the codes.
+                 */
+                static void quantize(const float *float_t, size_t numElements, float offset, float scale, uint8_t *code_t);
+
+                /*!
+                 * @brief This function quantizes an array of floats to 16 bits codes, rounding to the nearest code.
+                 * Values out of the range are clamped and NaN becomes the code 0.
+                 * @param float_t The array of floats.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param code_t The array that will store the codes.
+                 */
+                static void quantize(const float *float_t, size_t numElements, float offset, float scale, uint16_t *code_t);
+
+                /*!
+                 * @brief This function quantizes an array of doubles to 8 bits codes, rounding to the nearest code.
+                 * Values out of the range are clamped and NaN becomes the code 0.
+                 * @param double_t The array of doubles.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param code_t The array that will store the codes.
+                 */
+                static void quantize(const double *double_t, size_t numElements, float offset, float scale, uint8_t *code_t);
+
+                /*!
+                 * @brief This function quantizes an array of doubles to 16 bits codes, rounding to the nearest code.
+                 * Values out of the range are clamped and NaN becomes the code 0.
+                 * @param double_t The array of doubles.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param code_t The array that will store the codes.
+                 */
+                static void quantize(const double *double_t, size_t numElements, float offset, float scale, uint16_t *code_t);
+
+                /*!
+                 * @brief This function restores an array of floats from 8 bits codes.
+                 * The values are reconstructed in double precision and clamped to the float range.
+                 * @param code_t The array of codes.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param float_t The array that will store the floats.
+                 */
+                static void dequantize(const uint8_t *code_t, size_t numElements, float offset, float scale, float *float_t);
+
+                /*!
+                 * @brief This function restores an array of floats from 16 bits codes.
+                 * The values are reconstructed in double precision and clamped to the float range.
+                 * @param code_t The array of codes.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param float_t The array that will store the floats.
+                 */
+                static void dequantize(const uint16_t *code_t, size_t numElements, float offset, float scale, float *float_t);
+
+                /*!
+                 * @brief This function restores an array of doubles from 8 bits codes.
+                 * @param code_t The array of codes.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param double_t The array that will store the doubles.
+                 */
+                static void dequantize(const uint8_t *code_t, size_t numElements, float offset, float scale, double *double_t);
+
+                /*!
+                 * @brief This function restores an array of doubles from 16 bits codes.
+                 * @param code_t The array of codes.
+                 * @param numElements Number of the elements in the array.
+                 * @param offset The value of the code 0.
+                 * @param scale The difference between the values of consecutive codes.
+                 * @param double_t The array that will store the doubles.
+                 */
+                static void dequantize(const uint16_t *code_t, size_t numElements, float offset, float scale, double *double_t);
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_QUANTIZATIONCODEC_H_
@@ -0,0 +1,151 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_SHAREDBUFFER_H_
+#define _FASTCDR_SHAREDBUFFER_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include <stdint.h>
+#include <cstddef>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        struct SharedBufferBlock;
+
+        /*!
+         * @brief This class represents a serialized payload shared by several owners through an atomic reference count.
+         * Copying a eprosima::fastcdr::SharedBuffer object does not copy the payload, so a sample serialized once can be
+         * handed to many subscribers. The payload is immutable while it is shared: several threads can deserialize from it
+         * concurrently, each one with its own eprosima::fastcdr::CdrDecoder object over eprosima::fastcdr::SharedBuffer::getBuffer.
+         * Requesting write access to a shared payload copies it first (copy-on-write).
+         * A single eprosima::fastcdr::SharedBuffer object must not be modified from several threads at the same time.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI SharedBuffer
+        {
+            public:
+
+                /*!
+                 * @brief This constructor allocates an empty payload that can be serialized into.
+                 * @param capacity The size of the allocated memory.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the memory cannot be allocated.
+                 */
+                explicit SharedBuffer(size_t capacity = 0);
+
+                /*!
+                 * @brief This constructor allocates a payload and copies the given serialized data into it.
+                 * @param data The serialized data.
+                 * @param length The length of the serialized data.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the memory cannot be allocated.
+                 */
+                SharedBuffer(const char *data, size_t length);
+
+                /*!
+                 * @brief This constructor takes the serialized data of a eprosima::fastcdr::FastBuffer.
+                 * If the stream of the eprosima::fastcdr::FastBuffer is internal, its ownership is transferred without copying it
+                 * and the eprosima::fastcdr::FastBuffer is left empty. Otherwise the serialized data is copied.
+                 * @param buffer The eprosima::fastcdr::FastBuffer that contains the serialized data.
+                 * @param length The length of the serialized data.
+                 * @exception exception::BadParamException This exception is thrown when the length exceeds the size of the buffer.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the memory cannot be allocated.
+                 */
+                SharedBuffer(FastBuffer &buffer, size_t length);
+
+                /*!
+                 * @brief Copy constructor. The payload is shared, not copied.
+                 */
+                SharedBuffer(const SharedBuffer &buffer);
+
+                /*!
+                 * @brief Assignment operation. The payload is shared, not copied.
+                 */
+                SharedBuffer& operator=(const SharedBuffer &buffer);
+
+                /*!
+                 * @brief Default destructor. The payload is deallocated when its last owner is destroyed.
+                 */
+                virtual ~SharedBuffer();
+
+                /*!
+                 * @brief This function returns a read-only view of the payload.
+                 * The returned eprosima::fastcdr::ConstFastBuffer covers the serialized length and it may be used
+                 * by several eprosima::fastcdr::CdrDecoder objects deserializing concurrently.
+                 * Writing has to go through eprosima::fastcdr::SharedBuffer::getWritableBuffer.
+                 * @return A eprosima::fastcdr::ConstFastBuffer over the serialized data.
+                 */
+                const ConstFastBuffer& getBuffer() const;
+
+                /*!
+                 * @brief This function returns a writable view of the whole capacity of the payload.
+                 * If the payload is shared with other owners, it is copied first and this object becomes its only owner.
+                 * After serializing, the length has to be set with eprosima::fastcdr::SharedBuffer::setLength.
+                 * @return A eprosima::fastcdr::FastBuffer over the whole capacity of the payload.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the copy cannot be allocated.
+                 */
+                FastBuffer& getWritableBuffer();
+
+                /*!
+                 * @brief This function sets the serialized length of the payload.
+                 * @param length The serialized length. It cannot exceed the capacity.
+                 * @exception exception::BadParamException This exception is thrown when the length exceeds the capacity.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the payload has to be copied and the copy cannot be allocated.
+                 */
+                void setLength(size_t length);
+
+                /*!
+                 * @brief This function grows the capacity of the payload. If the payload is shared it is copied first.
+                 * @param capacity The minimum capacity.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the memory cannot be allocated.
+                 */
+                void reserve(size_t capacity);
+
+                /*!
+                 * @brief This function returns the serialized data.
+                 * @return Pointer to the serialized data.
+                 */
+                const char* getData() const;
+
+                /*!
+                 * @brief This function returns the serialized length.
+                 * @return The serialized length.
+                 */
+                size_t getLength() const;
+
+                /*!
+                 * @brief This function returns the size of the allocated memory.
+                 * @return The capacity of the payload.
+                 */
+                size_t getCapacity() const;
+
+                /*!
+                 * @brief This function returns the number of owners of the payload.
+                 * @return The number of eprosima::fastcdr::SharedBuffer objects sharing the payload.
+                 */
+                uint32_t getUseCount() const;
+
+            private:
+
+                //! @brief Makes this object the only owner of its payload, copying it if needed.
+                void detach(size_t capacity);
+
+                //! @brief Payload and reference count.
+                SharedBufferBlock *m_block;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_SHAREDBUFFER_H_
@@ -0,0 +1,193 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_SHMRING_H_
+#define _FASTCDR_SHMRING_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+
+#if !defined(_WIN32)
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        struct ShmRingControl;
+
+        /*!
+         * @brief This class implements a ring of fixed-size frames placed in a POSIX shared memory segment.
+         * A publisher serializes directly into the next free slot and a subscriber in another process
+         * deserializes in place from the mapped memory, so no copy is done between processes.
+         * Slot hand-off is lock-free. Blocked producers and the consumer sleep on futexes (Linux) placed in the segment.
+         * Only one consumer is supported. Several producers are supported when the ring is created with eprosima::fastcdr::ShmRing::MULTI_PRODUCER.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI ShmRing
+        {
+            public:
+
+                //! @brief This enumeration represents the producer models supported by eprosima::fastcdr::ShmRing.
+                typedef enum
+                {
+                    //! @brief Only one process/thread publishes frames. Slots are claimed without compare-and-swap.
+                    SINGLE_PRODUCER,
+                    //! @brief Several processes/threads publish frames. Slots are claimed with compare-and-swap.
+                    MULTI_PRODUCER
+                } ProducerMode;
+
+                /*!
+                 * @brief This class represents a slot of the ring acquired by a producer or received by the consumer.
+                 * A eprosima::fastcdr::FastBuffer can be constructed over its data to serialize or deserialize in place:
+                 * @code
+                 * FastBuffer buffer(frame.getData(), frame.getSize());
+                 * Cdr cdr(buffer);
+                 * @endcode
+                 */
+                class Cdr_DllAPI Frame
+                {
+                    friend class ShmRing;
+
+                    public:
+
+                    /*!
+                     * @brief Default constructor.
+                     */
+                    Frame() : m_data(NULL), m_size(0), m_ticket(0) {}
+
+                    /*!
+                     * @brief This function returns the pointer to the slot memory.
+                     * @return Pointer to the slot memory inside the mapped segment.
+                     */
+                    inline char* getData() const { return m_data; }
+
+                    /*!
+                     * @brief This function returns the usable size of the frame.
+                     * For an acquired frame it is the slot capacity. For a received frame it is the committed length.
+                     * @return The size of the frame in bytes.
+                     */
+                    inline size_t getSize() const { return m_size; }
+
+                    private:
+
+                    //! @brief Pointer to the slot memory.
+                    char *m_data;
+
+                    //! @brief Capacity or committed length of the slot.
+                    size_t m_size;
+
+                    //! @brief Position of the slot in the ring sequence.
+                    uint64_t m_ticket;
+                };
+
+                /*!
+                 * @brief This constructor creates a new shared memory segment and maps it.
+                 * @param name Name of the POSIX shared memory object (e.g. "/my_topic").
+                 * @param slotCount Number of slots. It has to be a power of two.
+                 * @param slotSize Maximum length of a frame in bytes.
+                 * @param mode Producer model of the ring.
+                 * @exception exception::BadParamException This exception is thrown when the parameters are invalid or the segment cannot be created.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the segment cannot be sized or mapped.
+                 */
+                ShmRing(const char *name, uint32_t slotCount, size_t slotSize, ProducerMode mode = SINGLE_PRODUCER);
+
+                /*!
+                 * @brief This constructor maps an existing shared memory segment created by another eprosima::fastcdr::ShmRing.
+                 * @param name Name of the POSIX shared memory object.
+                 * @exception exception::BadParamException This exception is thrown when the segment does not exist or it is not a valid ring.
+                 * @exception exception::NotEnoughMemoryException This exception is thrown when the segment cannot be mapped.
+                 */
+                explicit ShmRing(const char *name);
+
+                /*!
+                 * @brief Default destructor. The segment is unmapped but not unlinked.
+                 */
+                virtual ~ShmRing();
+
+                /*!
+                 * @brief This function removes the shared memory object name. Mapped segments stay valid until unmapped.
+                 * @param name Name of the POSIX shared memory object.
+                 * @return True if the name was removed. False if it was not.
+                 */
+                static bool unlink(const char *name);
+
+                /*!
+                 * @brief This function acquires the next free slot for a producer.
+                 * @param frame The frame that will point to the acquired slot.
+                 * @param timeoutMs Maximum time to wait for a free slot in milliseconds. A negative value waits forever.
+                 * @return True if a slot was acquired. False if the timeout expired.
+                 */
+                bool acquire(Frame &frame, int32_t timeoutMs = -1);
+
+                /*!
+                 * @brief This function publishes an acquired frame to the consumer.
+                 * @param frame The frame returned by eprosima::fastcdr::ShmRing::acquire.
+                 * @param length The number of bytes serialized in the frame.
+                 * @exception exception::BadParamException This exception is thrown when the length exceeds the slot size.
+                 */
+                void commit(Frame &frame, size_t length);
+
+                /*!
+                 * @brief This function receives the next published frame.
+                 * Several frames can be received before releasing them, and they can be released in any order.
+                 * @param frame The frame that will point to the received slot.
+                 * @param timeoutMs Maximum time to wait for a frame in milliseconds. A negative value waits forever.
+                 * @return True if a frame was received. False if the timeout expired.
+                 */
+                bool receive(Frame &frame, int32_t timeoutMs = -1);
+
+                /*!
+                 * @brief This function returns a received frame's slot to the producers.
+                 * @param frame The frame returned by eprosima::fastcdr::ShmRing::receive.
+                 */
+                void release(Frame &frame);
+
+                /*!
+                 * @brief This function returns the number of slots of the ring.
+                 * @return The number of slots.
+                 */
+                uint32_t getSlotCount() const;
+
+                /*!
+                 * @brief This function returns the maximum length of a frame.
+                 * @return The slot size in bytes.
+                 */
+                size_t getSlotSize() const;
+
+            private:
+
+                ShmRing(const ShmRing&) NON_COPYABLE_CXX11;
+
+                ShmRing& operator=(const ShmRing&) NON_COPYABLE_CXX11;
+
+                //! @brief Returns the slot header of the given sequence position.
+                char* slotAt(uint64_t ticket) const;
+
+                //! @brief Name of the shared memory object.
+                std::string m_name;
+
+                //! @brief Control block at the beginning of the mapped segment.
+                ShmRingControl *m_control;
+
+                //! @brief Total length of the mapped segment.
+                size_t m_mappedSize;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // !_WIN32
+
+#endif // _FASTCDR_SHMRING_H_
@@ -0,0 +1,196 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_SIZEREGISTRY_H_
+#define _FASTCDR_SIZEREGISTRY_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <typeinfo>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class records the distribution of the serialized sizes of each message type
+         * and recommends the initial size of the buffers of that type, so buffers stop being resized once the distribution is known.
+         * Types are identified by a user tag or by their type_info.
+         * The registry is a manual helper: eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr do not use it by themselves.
+         * Callers grow each buffer with eprosima::fastcdr::SizeRegistry::prepare before serializing a sample,
+         * and report the result of getSerializedDataLength() with eprosima::fastcdr::SizeRegistry::record afterwards.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI SizeRegistry
+        {
+            public:
+
+                /*!
+                 * @brief This class stores the histogram of the serialized sizes of one type.
+                 * Sizes are counted in logarithmic buckets, four for each power of two, so recording is a few atomic increments.
+                 * It can be used from several threads.
+                 */
+                class Cdr_DllAPI Entry
+                {
+                    public:
+
+                        Entry();
+
+                        /*!
+                         * @brief This function records a serialized size.
+                         * @param size The serialized size.
+                         */
+                        void record(size_t size);
+
+                        /*!
+                         * @brief This function returns the number of recorded sizes.
+                         * @return The number of recorded sizes.
+                         */
+                        inline uint64_t getCount() const { return m_count.load(std::memory_order_relaxed);}
+
+                        /*!
+                         * @brief This function returns the biggest recorded size.
+                         * @return The biggest recorded size.
+                         */
+                        inline size_t getMaxSize() const { return m_maxSize.load(std::memory_order_relaxed);}
+
+                        /*!
+                         * @brief This function returns an upper bound of the given percentile of the recorded sizes.
+                         * @param percentile The percentile, between 0 and 1.
+                         * @return The upper bound of the bucket containing the percentile, never more than the biggest recorded size. 0 if no size was recorded.
+                         */
+                        size_t getPercentile(double percentile) const;
+
+                    private:
+
+                        Entry(const Entry&) NON_COPYABLE_CXX11;
+
+                        Entry& operator=(const Entry&) NON_COPYABLE_CXX11;
+
+                        static const size_t NUM_BUCKETS = 4 * 64;
+
+                        std::atomic<uint64_t> m_buckets[NUM_BUCKETS];
+
+                        std::atomic<uint64_t> m_count;
+
+                        std::atomic<size_t> m_maxSize;
+                };
+
+                /*!
+                 * @brief This constructor creates an empty registry.
+                 * @param percentile The percentile of the recorded sizes used as recommended size.
+                 * @param margin The fraction added to the percentile, e.g. 0.125 for 12.5%.
+                 * @param defaultSize The size recommended for a type without recorded sizes.
+                 */
+                explicit SizeRegistry(double percentile = 0.99, double margin = 0.125, size_t defaultSize = 0);
+
+                /*!
+                 * @brief Default destructor.
+                 */
+                virtual ~SizeRegistry();
+
+                /*!
+                 * @brief This function returns the entry of a tag, creating it if needed.
+                 * The reference stays valid while the registry exists, so callers in the hot path can keep it and record without looking it up.
+                 * @param tag The tag identifying the type.
+                 * @return The entry of the tag.
+                 */
+                Entry& getEntry(const std::string &tag);
+
+                /*!
+                 * @brief This function template returns the entry of a type, identified by its type_info.
+                 * @return The entry of the type.
+                 */
+                template<class _T>
+                    inline Entry& getEntry() { return getEntry(std::string(typeid(_T).name()));}
+
+                /*!
+                 * @brief This function records a serialized size of a tag.
+                 * @param tag The tag identifying the type.
+                 * @param size The serialized size.
+                 */
+                inline void record(const std::string &tag, size_t size) { getEntry(tag).record(size);}
+
+                /*!
+                 * @brief This function template records a serialized size of a type.
+                 * @param size The serialized size.
+                 */
+                template<class _T>
+                    inline void record(size_t size) { getEntry<_T>().record(size);}
+
+                /*!
+                 * @brief This function returns the size recommended for the buffers of an entry: the percentile plus the margin.
+                 * @param entry The entry.
+                 * @return The recommended size.
+                 */
+                size_t getRecommendedSize(const Entry &entry) const;
+
+                /*!
+                 * @brief This function returns the size recommended for the buffers of a tag.
+                 * @param tag The tag identifying the type.
+                 * @return The recommended size.
+                 */
+                inline size_t getRecommendedSize(const std::string &tag) { return getRecommendedSize(getEntry(tag));}
+
+                /*!
+                 * @brief This function template returns the size recommended for the buffers of a type.
+                 * @return The recommended size.
+                 */
+                template<class _T>
+                    inline size_t getRecommendedSize() { return getRecommendedSize(getEntry<_T>());}
+
+                /*!
+                 * @brief This function grows a eprosima::fastcdr::FastBuffer to the size recommended for a tag.
+                 * @param buffer The eprosima::fastcdr::FastBuffer.
+                 * @param tag The tag identifying the type.
+                 * @return True if the buffer has the recommended size after the operation.
+                 */
+                inline bool prepare(FastBuffer &buffer, const std::string &tag) { return buffer.reserve(getRecommendedSize(tag));}
+
+                /*!
+                 * @brief This function template grows a eprosima::fastcdr::FastBuffer to the size recommended for a type.
+                 * @param buffer The eprosima::fastcdr::FastBuffer.
+                 * @return True if the buffer has the recommended size after the operation.
+                 */
+                template<class _T>
+                    inline bool prepare(FastBuffer &buffer) { return buffer.reserve(getRecommendedSize<_T>());}
+
+            private:
+
+                SizeRegistry(const SizeRegistry&) NON_COPYABLE_CXX11;
+
+                SizeRegistry& operator=(const SizeRegistry&) NON_COPYABLE_CXX11;
+
+                double m_percentile;
+
+                double m_margin;
+
+                size_t m_defaultSize;
+
+                //! @brief Protects m_entries. Entries are never removed, so their addresses are stable.
+                std::mutex m_mutex;
+
+                std::map<std::string, std::unique_ptr<Entry>> m_entries;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_SIZEREGISTRY_H_
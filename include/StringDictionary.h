@@ -0,0 +1,128 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_STRINGDICTIONARY_H_
+#define _FASTCDR_STRINGDICTIONARY_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class stores the strings of a batch of messages, so each one is serialized in full only once.
+         * A string is serialized as a reference: 0 followed by the string the first time, and the position of the string in the dictionary
+         * plus one after that. A dictionary is used either to serialize or to deserialize a batch, and it has to be cleared between batches.
+         * When deserializing, the dictionary keeps views of the strings in the buffer instead of copies,
+         * so the buffer has to outlive the dictionary and its views.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI StringDictionary
+        {
+            public:
+
+                /*!
+                 * @brief This structure points to a string of the dictionary, without owning it.
+                 */
+                struct View
+                {
+                    View() : data(""), length(0) {}
+
+                    View(const char *data_t, size_t length_t) : data(data_t), length(length_t) {}
+
+                    //! @brief This function returns a copy of the string.
+                    inline std::string str() const { return std::string(data, length);}
+
+                    //! @brief The characters of the string. They are followed by the null character when the serialized string had it.
+                    const char *data;
+
+                    //! @brief The length of the string, without the null character.
+                    size_t length;
+                };
+
+                StringDictionary();
+
+                /*!
+                 * @brief This function removes all the strings, keeping the allocated memory for the next batch.
+                 */
+                void clear();
+
+                /*!
+                 * @brief This function returns the number of strings of the dictionary.
+                 * @return The number of strings.
+                 */
+                inline size_t size() const { return m_views.size();}
+
+                /*!
+                 * @brief This function finds a string in a dictionary used for serialization.
+                 * @param string_t The characters of the string.
+                 * @param length The length of the string.
+                 * @return The reference of the string, or 0 if the dictionary does not contain it.
+                 */
+                uint32_t find(const char *string_t, size_t length) const;
+
+                /*!
+                 * @brief This function adds a copy of a string to a dictionary used for serialization.
+                 * @param string_t The characters of the string.
+                 * @param length The length of the string.
+                 * @return The reference of the string.
+                 */
+                uint32_t add(const char *string_t, size_t length);
+
+                /*!
+                 * @brief This function adds a view of a deserialized string to a dictionary used for deserialization.
+                 * @param string_t The characters of the string in the buffer.
+                 * @param length The length of the string.
+                 * @return The reference of the string.
+                 */
+                uint32_t addView(const char *string_t, size_t length);
+
+                /*!
+                 * @brief This function returns the string with a reference.
+                 * @param reference The reference of the string. It cannot be 0.
+                 * @return The view of the string.
+                 * @exception exception::BadParamException This exception is thrown when the dictionary does not contain the reference.
+                 */
+                const View& getView(uint32_t reference) const;
+
+            private:
+
+                StringDictionary(const StringDictionary&) NON_COPYABLE_CXX11;
+
+                StringDictionary& operator=(const StringDictionary&) NON_COPYABLE_CXX11;
+
+                //! @brief The strings, as views of m_characters or of the deserialized buffer.
+                std::vector<View> m_views;
+
+                //! @brief Offsets in m_characters of the strings added for serialization.
+                std::vector<size_t> m_offsets;
+
+                //! @brief Hashes of the strings added for serialization.
+                std::vector<uint32_t> m_hashes;
+
+                //! @brief Copies of the strings added for serialization.
+                std::vector<char> m_characters;
+
+                //! @brief Open addressing table with the references of the strings added for serialization. 0 marks an empty slot.
+                std::vector<uint32_t> m_table;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_STRINGDICTIONARY_H_
@@ -0,0 +1,145 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_THREADPOOL_H_
+#define _FASTCDR_THREADPOOL_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class implements a fixed pool of worker threads used by the parallel serialization functions.
+         * The pool runs one parallel job at a time. The calling thread takes part in the job.
+         * The tasks of a job are scheduled by work stealing: each thread starts with its own contiguous range of task indices
+         * and, when it runs out of them, steals the upper half of the remaining range of another thread.
+         * A job started while the pool is busy, or from inside a task of the same pool, runs sequentially in the calling thread.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI ThreadPool
+        {
+            public:
+
+                /*!
+                 * @brief This constructor starts the worker threads.
+                 * @param numThreads Number of threads that run a job, including the calling thread.
+                 * The default value 0 uses the number of hardware threads.
+                 */
+                explicit ThreadPool(size_t numThreads = 0);
+
+                /*!
+                 * @brief Default destructor. It stops and joins the worker threads.
+                 */
+                virtual ~ThreadPool();
+
+                /*!
+                 * @brief This function returns the number of threads that run a job, including the calling thread.
+                 * @return The number of threads.
+                 */
+                inline size_t getNumThreads() const { return m_workers.size() + 1; }
+
+                /*!
+                 * @brief This function runs numTasks tasks on the pool and waits until all of them have finished.
+                 * @param numTasks Number of tasks. Each task receives its index, from 0 to numTasks - 1.
+                 * @param task The function called for each task.
+                 * If a task throws, the remaining tasks are skipped and the first exception is rethrown in the calling thread.
+                 */
+                void parallelFor(size_t numTasks, const std::function<void(size_t)> &task);
+
+            private:
+
+                ThreadPool(const ThreadPool&) NON_COPYABLE_CXX11;
+
+                ThreadPool& operator=(const ThreadPool&) NON_COPYABLE_CXX11;
+
+                /*!
+                 * @brief This structure stores the range of task indices not started yet by one thread.
+                 * The owner takes tasks from the beginning and thieves take the upper half.
+                 */
+                struct alignas(64) TaskRange
+                {
+                    std::mutex mutex;
+                    size_t begin;
+                    size_t end;
+                };
+
+                //! @brief Main loop of the worker threads.
+                void workerLoop(size_t self);
+
+                //! @brief Runs tasks of the current job, stealing them from other threads, until there are no more.
+                void runTasks(size_t self);
+
+                //! @brief Takes the next task of the thread's own range.
+                bool popTask(size_t self, size_t &index);
+
+                //! @brief Moves the upper half of another thread's range to the thread's own range and takes its first task.
+                bool stealTasks(size_t self, size_t &index);
+
+                //! @brief Worker threads.
+                std::vector<std::thread> m_workers;
+
+                //! @brief Serializes the jobs submitted to the pool.
+                std::mutex m_submitMutex;
+
+                //! @brief Protects the job publication.
+                std::mutex m_mutex;
+
+                //! @brief Signalled when a job is published or the pool is stopped.
+                std::condition_variable m_jobCondition;
+
+                //! @brief Signalled when the last worker leaves a job.
+                std::condition_variable m_doneCondition;
+
+                //! @brief Incremented for every published job.
+                uint64_t m_generation;
+
+                //! @brief True when the destructor is stopping the workers.
+                bool m_stop;
+
+                //! @brief Task function of the current job.
+                const std::function<void(size_t)> *m_task;
+
+                //! @brief Number of tasks of the current job.
+                size_t m_numTasks;
+
+                //! @brief Task ranges of the threads. Index 0 belongs to the calling thread, index i to the worker i - 1.
+                std::vector<TaskRange> m_ranges;
+
+                //! @brief Number of workers still inside the current job.
+                size_t m_activeWorkers;
+
+                //! @brief True when a task of the current job has thrown.
+                std::atomic<bool> m_failed;
+
+                //! @brief First exception thrown by a task of the current job.
+                std::exception_ptr m_exception;
+
+                //! @brief Protects m_exception.
+                std::mutex m_exceptionMutex;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_THREADPOOL_H_
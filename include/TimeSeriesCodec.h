@@ -0,0 +1,163 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_TIMESERIESCODEC_H_
+#define _FASTCDR_TIMESERIESCODEC_H_
+
+#include "fastcdr_dll.h"
+#include <stdint.h>
+#include <cstddef>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers lossless codecs for arrays of slowly changing values, as the ones of time series.
+         * Floating point values are encoded as the XOR with the previous value, storing only its meaningful bits
+         * and reusing the window of leading and trailing zeros of the previous value when it fits.
+         * Integer values are encoded as the difference between consecutive deltas, with a variable length prefix code.
+         * The encoded stream is a sequence of bits, most significant first, and does not depend on the endianness of the host.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI TimeSeriesCodec
+        {
+            public:
+
+                /*!
+                 * @brief This function returns the maximum size of an encoded array.
+                 * @param numElements Number of the elements in the array.
+                 * @param elementSize Size of the elements, 4 or 8 bytes.
+                 * @return The size in bytes.
+                 */
+                static size_t getMaxEncodedSize(size_t numElements, size_t elementSize);
+
+                /*!
+                 * @brief This function encodes an array of doubles.
+                 * @param double_t The array of doubles.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the array is encoded. Its size has to be eprosima::fastcdr::TimeSeriesCodec::getMaxEncodedSize.
+                 * @return The size of the encoded array.
+                 */
+                static size_t encode(const double *double_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function encodes an array of floats.
+                 * @param float_t The array of floats.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the array is encoded. Its size has to be eprosima::fastcdr::TimeSeriesCodec::getMaxEncodedSize.
+                 * @return The size of the encoded array.
+                 */
+                static size_t encode(const float *float_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function encodes an array of long longs.
+                 * @param longlong_t The array of long longs.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the array is encoded. Its size has to be eprosima::fastcdr::TimeSeriesCodec::getMaxEncodedSize.
+                 * @return The size of the encoded array.
+                 */
+                static size_t encode(const int64_t *longlong_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function encodes an array of unsigned long longs.
+                 * @param ulonglong_t The array of unsigned long longs.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the array is encoded. Its size has to be eprosima::fastcdr::TimeSeriesCodec::getMaxEncodedSize.
+                 * @return The size of the encoded array.
+                 */
+                static size_t encode(const uint64_t *ulonglong_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function encodes an array of longs.
+                 * @param long_t The array of longs.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the array is encoded. Its size has to be eprosima::fastcdr::TimeSeriesCodec::getMaxEncodedSize.
+                 * @return The size of the encoded array.
+                 */
+                static size_t encode(const int32_t *long_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function encodes an array of unsigned longs.
+                 * @param ulong_t The array of unsigned longs.
+                 * @param numElements Number of the elements in the array.
+                 * @param destination The memory where the array is encoded. Its size has to be eprosima::fastcdr::TimeSeriesCodec::getMaxEncodedSize.
+                 * @return The size of the encoded array.
+                 */
+                static size_t encode(const uint32_t *ulong_t, size_t numElements, char *destination);
+
+                /*!
+                 * @brief This function decodes an array of doubles.
+                 * @param source The encoded array.
+                 * @param size The size of the encoded array.
+                 * @param double_t The array that will store the doubles.
+                 * @param numElements Number of the elements in the array.
+                 * @return False if the encoded array is truncated or malformed.
+                 */
+                static bool decode(const char *source, size_t size, double *double_t, size_t numElements);
+
+                /*!
+                 * @brief This function decodes an array of floats.
+                 * @param source The encoded array.
+                 * @param size The size of the encoded array.
+                 * @param float_t The array that will store the floats.
+                 * @param numElements Number of the elements in the array.
+                 * @return False if the encoded array is truncated or malformed.
+                 */
+                static bool decode(const char *source, size_t size, float *float_t, size_t numElements);
+
+                /*!
+                 * @brief This function decodes an array of long longs.
+                 * @param source The encoded array.
+                 * @param size The size of the encoded array.
+                 * @param longlong_t The array that will store the long longs.
+                 * @param numElements Number of the elements in the array.
+                 * @return False if the encoded array is truncated or malformed.
+                 */
+                static bool decode(const char *source, size_t size, int64_t *longlong_t, size_t numElements);
+
+                /*!
+                 * @brief This function decodes an array of unsigned long longs.
+                 * @param source The encoded array.
+                 * @param size The size of the encoded array.
+                 * @param ulonglong_t The array that will store the unsigned long longs.
+                 * @param numElements Number of the elements in the array.
+                 * @return False if the encoded array is truncated or malformed.
+                 */
+                static bool decode(const char *source, size_t size, uint64_t *ulonglong_t, size_t numElements);
+
+                /*!
+                 * @brief This function decodes an array of longs.
+                 * @param source The encoded array.
+                 * @param size The size of the encoded array.
+                 * @param long_t The array that will store the longs.
+                 * @param numElements Number of the elements in the array.
+                 * @return False if the encoded array is truncated or malformed.
+                 */
+                static bool decode(const char *source, size_t size, int32_t *long_t, size_t numElements);
+
+                /*!
+                 * @brief This function decodes an array of unsigned longs.
+                 * @param source The encoded array.
+                 * @param size The size of the encoded array.
+                 * @param ulong_t The array that will store the unsigned longs.
+                 * @param numElements Number of the elements in the array.
+                 * @return False if the encoded array is truncated or malformed.
+                 */
+                static bool decode(const char *source, size_t size, uint32_t *ulong_t, size_t numElements);
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_TIMESERIESCODEC_H_
@@ -0,0 +1,114 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_WARMUP_H_
+#define _FASTCDR_WARMUP_H_
+
+#include "fastcdr_dll.h"
+#include "FastBuffer.h"
+#include "Cdr.h"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastcdr
+    {
+        /*!
+         * @brief This class offers functions to prepare buffers and code paths before the first real sample is processed.
+         * Buffers are pre-sized and their pages pre-faulted, and optionally locked in memory, so serializing does not hit page faults.
+         * Registered types are serialized and deserialized with dummy samples so their code and data are already in the caches.
+         * @ingroup FASTCDRAPIREFERENCE
+         */
+        class Cdr_DllAPI Warmup
+        {
+            public:
+
+                /*!
+                 * @brief This function touches every page of a memory region so the page faults happen now.
+                 * The pages are only read, so the region may be read-only or shared with other threads.
+                 * Untouched anonymous memory may then be mapped to the zero page until its first write, unless it is locked.
+                 * @param data The memory region.
+                 * @param size The size of the memory region.
+                 * @param lock True to lock the pages in memory with mlock(). They stay locked until eprosima::fastcdr::Warmup::unlock is called.
+                 * @return False if the pages had to be locked and they could not be. True otherwise.
+                 */
+                static bool prefault(char *data, size_t size, bool lock = false);
+
+                /*!
+                 * @brief This function grows the internal stream of a eprosima::fastcdr::FastBuffer and touches every page of it.
+                 * The internal stream is written in place so its pages are really allocated. A stream of the user is only read, up to its size.
+                 * The eprosima::fastcdr::Cdr and eprosima::fastcdr::FastCdr objects using this buffer have to be reset after this call.
+                 * @param buffer The eprosima::fastcdr::FastBuffer.
+                 * @param size The minimum size of the stream, excluding the headroom and the tailroom.
+                 * @param lock True to lock the pages in memory with mlock(). Growing the stream later moves it away from the locked pages,
+                 * so call eprosima::fastcdr::Warmup::unlock before the stream grows or is released.
+                 * @return False if the stream could not be grown or its pages could not be locked. True otherwise.
+                 */
+                static bool prefault(FastBuffer &buffer, size_t size, bool lock = false);
+
+                /*!
+                 * @brief This function unlocks the pages of a memory region locked by eprosima::fastcdr::Warmup::prefault.
+                 * @param data The memory region.
+                 * @param size The size of the memory region.
+                 * @return False if the pages could not be unlocked. True otherwise.
+                 */
+                static bool unlock(char *data, size_t size);
+
+                /*!
+                 * @brief This function unlocks the pages of the stream of a eprosima::fastcdr::FastBuffer locked by eprosima::fastcdr::Warmup::prefault.
+                 * It has to be called before the stream grows or is released, while it is still at the locked address.
+                 * @param buffer The eprosima::fastcdr::FastBuffer.
+                 * @return False if the pages could not be unlocked. True otherwise.
+                 */
+                static bool unlock(FastBuffer &buffer);
+
+                /*!
+                 * @brief This function template registers a type whose code paths are warmed by eprosima::fastcdr::Warmup::run.
+                 * @param sample The sample serialized and deserialized. It should have the size and shape of the real samples.
+                 */
+                template<class _T>
+                    void registerType(const _T &sample = _T())
+                    {
+                        m_types.push_back([sample](FastBuffer &buffer, Cdr::Endianness endianness)
+                                {
+                                    _T copy(sample);
+
+                                    {
+                                        Cdr cdr(buffer, endianness);
+                                        cdr << sample;
+                                    }
+
+                                    Cdr cdr(buffer, endianness);
+                                    cdr >> copy;
+                                });
+                    }
+
+                /*!
+                 * @brief This function serializes and deserializes the samples of the registered types,
+                 * in both endiannesses, so the first real sample does not pay for cold code and data.
+                 * @param iterations Number of times each sample is processed in each endianness.
+                 */
+                void run(size_t iterations = 64);
+
+            private:
+
+                //! @brief Warm-up functions of the registered types.
+                std::vector<std::function<void(FastBuffer&, Cdr::Endianness)>> m_types;
+        };
+    } //namespace fastcdr
+} //namespace eprosima
+
+#endif // _FASTCDR_WARMUP_H_